@@ -0,0 +1,158 @@
+#include "bench.h"
+#include "blit.h"
+#include "bmp.h"
+#include "st7735.h"
+#include "pico/stdlib.h"
+#include "hardware/structs/systick.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ── Cycle counter ─────────────────────────────────────────────────────────────
+// SysTick is a 24-bit down-counter; anything measured must finish within
+// 2^24 cycles (~134 ms at 125 MHz).
+
+static void _cycles_init(void) {
+    systick_hw->rvr = 0x00FFFFFF;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5;   // enable, processor clock, no interrupt
+}
+
+static inline uint32_t _cycles_now(void) {
+    return systick_hw->cvr;
+}
+
+static inline uint32_t _cycles_since(uint32_t start) {
+    return (start - systick_hw->cvr) & 0x00FFFFFF;
+}
+
+// ── Sprite decode ─────────────────────────────────────────────────────────────
+
+// Rebuild entry e as the 32-bpp bottom-up BMP it was generated from
+static uint8_t *_make_bmp(const SpriteEntry *e, uint32_t *len) {
+    uint32_t stride = e->w * 4;
+    uint32_t size   = 54 + stride * e->h;
+    uint8_t *bmp = calloc(1, size);
+    if (!bmp) return NULL;
+    bmp[0] = 'B'; bmp[1] = 'M';
+    memcpy(bmp + 2,  &size, 4);
+    bmp[10] = 54; bmp[14] = 40;
+    uint32_t w = e->w, h = e->h;
+    memcpy(bmp + 18, &w, 4);
+    memcpy(bmp + 22, &h, 4);
+    bmp[26] = 1; bmp[28] = 32;
+
+    SpriteRows rows;
+    sprite_rows_begin(&rows, e);
+    for (int y = 0; y < e->h; y++) {
+        const uint8_t *src = sprite_rows_next(&rows, y);
+        uint8_t *dst = bmp + 54 + (e->h - 1 - y) * stride;
+        for (int x = 0; x < e->w; x++) {
+            uint8_t i = (e->bpp == 8) ? src[x]
+                      : (x & 1) ? (src[x >> 1] & 0x0F) : (src[x >> 1] >> 4);
+            uint16_t c = SWAP16(e->palette[i]);   // back to host order
+            dst[x*4 + 0] = (c << 3) & 0xF8;
+            dst[x*4 + 1] = (c >> 3) & 0xFC;
+            dst[x*4 + 2] = (c >> 8) & 0xF8;
+            dst[x*4 + 3] = i ? 0xFF : 0x00;
+        }
+    }
+    *len = size;
+    return bmp;
+}
+
+void bench_sprite_decode(const SpriteEntry *table, int n) {
+    _cycles_init();
+    printf("bench: sprite decode (cycles/frame)\n");
+
+    uint32_t sum_rows = 0, sum_bmp = 0;
+    int frames = 0;
+    static SpriteRows rows;
+    static volatile uint16_t rgb[SPRITE_MAX_W];   // keep the expansion live
+
+    for (int k = 0; k < n; k++) {
+        const SpriteEntry *e = &table[k];
+        if (!SPRITE_IS_KEY(e->kind)) continue;
+
+        // Streaming path: decode each packed row and expand it to RGB565
+        uint32_t t0 = _cycles_now();
+        sprite_rows_begin(&rows, e);
+        for (int y = 0; y < e->h; y++) {
+            const uint8_t *src = sprite_rows_next(&rows, y);
+            for (int x = 0; x < e->w; x++) {
+                uint8_t i = (e->bpp == 8) ? src[x]
+                          : (x & 1) ? (src[x >> 1] & 0x0F) : (src[x >> 1] >> 4);
+                rgb[x] = e->palette[i];
+            }
+        }
+        uint32_t c_rows = _cycles_since(t0);
+
+        // Previous path: whole-frame bmp_load_mem into a malloc'd buffer
+        // (includes its UART log line, as it did in the frame loop)
+        uint32_t len;
+        uint8_t *bmp = _make_bmp(e, &len);
+        if (!bmp) continue;
+        int w, h;
+        t0 = _cycles_now();
+        uint8_t *px = bmp_load_mem(bmp, len, &w, &h);
+        uint32_t c_bmp = _cycles_since(t0);
+        free(px);
+        free(bmp);
+
+        printf("  #%-3d %dx%d %s %3lu B: rows %6lu  bmp_load_mem %8lu\n",
+               k, e->w, e->h,
+               e->kind == SPRITE_KEY_LZ ? "lz " : "raw",
+               (unsigned long)e->len, (unsigned long)c_rows, (unsigned long)c_bmp);
+        sum_rows += c_rows; sum_bmp += c_bmp; frames++;
+    }
+
+    if (frames)
+        printf("bench: mean rows %lu, bmp_load_mem %lu cycles; decoder RAM %u B\n",
+               (unsigned long)(sum_rows / frames), (unsigned long)(sum_bmp / frames),
+               (unsigned)sizeof(SpriteRows));
+}
+
+// ── Sprite row backends ───────────────────────────────────────────────────────
+
+typedef void (*_sprite_fn)(const uint8_t *, int, int, int, int, int, const uint16_t *, uint16_t *);
+
+// One frame the way the scene draws a sprite layer: every output row
+// stretches the source row it samples
+static uint32_t _stretch_frame(const uint8_t *idx, const uint16_t *pal, int sw, int sh,
+                               int dw, int dh, _sprite_fn row_fn) {
+    static volatile uint16_t line[TFT_W];
+    const uint8_t *ymap = blit_map(sh, dh);
+    blit_map(sw, dw);                       // both maps cached before timing
+
+    uint32_t t0 = _cycles_now();
+    for (int r = 0; r < dh; r++)
+        row_fn(idx + ymap[r] * sw, 8, sw, dw, 0, dw, pal, (uint16_t *)line);
+    return _cycles_since(t0);
+}
+
+void bench_blit_stretch(void) {
+    _cycles_init();
+    printf("bench: sprite rows, 8 bpp (cycles/frame)\n");
+
+    static uint8_t  idx[72 * 72];
+    static uint16_t pal[256];
+    for (int i = 0; i < 72 * 72; i++) idx[i] = (uint8_t)(i * 37);
+    for (int i = 0; i < 256; i++) pal[i] = (uint16_t)(i * 0x9E37u);
+
+    static const int sizes[][2] = { { 24, 24 }, { 32, 32 }, { 48, 48 }, { 72, 72 } };
+    for (unsigned k = 0; k < sizeof sizes / sizeof sizes[0]; k++) {
+        int sw = sizes[k][0], sh = sizes[k][1];
+        int x, y, dw, dh;
+        tft_fit(sw, sh, TFT_FIT_ASPECT, &x, &y, &dw, &dh);
+
+        uint32_t c_c = _stretch_frame(idx, pal, sw, sh, dw, dh, blit_sprite_row_c);
+#if BLIT_INTERP
+        uint32_t c_i = _stretch_frame(idx, pal, sw, sh, dw, dh, blit_sprite_row_interp);
+        printf("  %2dx%-2d -> %2dx%-3d: c %7lu  interp %7lu\n",
+               sw, sh, dw, dh, (unsigned long)c_c, (unsigned long)c_i);
+#else
+        printf("  %2dx%-2d -> %2dx%-3d: c %7lu  (interp backend not built)\n",
+               sw, sh, dw, dh, (unsigned long)c_c);
+#endif
+    }
+}
@@ -0,0 +1,17 @@
+#pragma once
+#include <stdint.h>
+#include "sprite.h"
+
+// On-target benchmarks, built only with -DTAMAGOTCHI_BENCH=ON.
+// Results are printed over the debug UART; cycle counts come from SysTick
+// running at the core clock.
+
+// Decode every key frame in table both ways and print cycles per frame:
+// the streaming row decoder (LZ/raw → RGB565 rows) against bmp_load_mem on
+// the same frame rebuilt as a 32-bpp BMP.
+void bench_sprite_decode(const SpriteEntry *table, int n);
+
+// Stretch 8-bpp palette frames to fractional screen sizes as the scene does
+// and print cycles per frame for the C sprite-row backend and, when built
+// in, the interpolator one.
+void bench_blit_stretch(void);
@@ -0,0 +1,119 @@
+#include "blit.h"
+#if BLIT_INTERP
+#include "hardware/interp.h"
+#endif
+
+// ── Fractional maps ───────────────────────────────────────────────────────────
+
+namespace {
+
+struct MapSlot {
+    uint16_t n, d;              // d 0 = empty
+    uint32_t used;
+    uint8_t  map[BLIT_MAP_MAX];
+};
+
+MapSlot  slots[BLIT_MAP_SLOTS];
+uint32_t map_clock;
+
+void build_map(uint8_t *map, int n, int d) {
+    uint32_t step = (static_cast<uint32_t>(n) << 16) / d;
+    uint32_t pos  = step >> 1;
+    for (int i = 0; i < d; i++, pos += step)
+        map[i] = pos >> 16;
+}
+
+} // namespace
+
+const uint8_t *blit_map(int n, int d) {
+    if (n < 1 || n > BLIT_MAP_MAX || d < 1 || d > BLIT_MAP_MAX) return nullptr;
+
+    MapSlot *victim = &slots[0];
+    for (MapSlot &s : slots) {
+        if (s.n == n && s.d == d) {
+            s.used = ++map_clock;
+            return s.map;
+        }
+        if (s.used < victim->used) victim = &s;
+    }
+    build_map(victim->map, n, d);
+    victim->n    = n;
+    victim->d    = d;
+    victim->used = ++map_clock;
+    return victim->map;
+}
+
+void blit_map_span(const uint8_t *map, int d, int s0, int s1, int *o0, int *o1) {
+    int i = 0;
+    while (i < d && map[i] < s0) i++;
+    *o0 = i;
+    while (i < d && map[i] <= s1) i++;
+    *o1 = i - 1;
+}
+
+// ── C backend ─────────────────────────────────────────────────────────────────
+
+void blit_sprite_row_c(const uint8_t *row, int bpp, int n, int d, int o, int count,
+                       const uint16_t *pal, uint16_t *dst) {
+    const uint8_t *map = blit_map(n, d);
+    if (!map) return;
+    map += o;
+    if (bpp == 8) {
+        for (int i = 0; i < count; i++) {
+            uint8_t k = row[map[i]];
+            if (k) dst[i] = pal[k];
+        }
+        return;
+    }
+    for (int i = 0; i < count; i++) {
+        int     sx = map[i];
+        uint8_t k  = (bpp == 4) ? ((sx & 1) ? (row[sx >> 1] & 0x0F) : (row[sx >> 1] >> 4))
+                                : (row[sx >> 3] >> (7 - (sx & 7))) & 1;
+        if (k) dst[i] = pal[k];
+    }
+}
+
+// ── Interpolator backend ──────────────────────────────────────────────────────
+// Lane 0 accumulates the 16.16 source position (add_raw, so the full step is
+// added back on every pop) and presents its integer part to the FULL
+// result, which adds the row base: one pop per output pixel yields the
+// address of the source index, with no map to read.
+
+#if BLIT_INTERP
+void blit_sprite_row_interp(const uint8_t *row, int bpp, int n, int d, int o, int count,
+                            const uint16_t *pal, uint16_t *dst) {
+    (void)bpp;
+    uint32_t step = (static_cast<uint32_t>(n) << 16) / d;
+
+    interp_config c = interp_default_config();
+    interp_config_set_add_raw(&c, true);
+    interp_config_set_shift(&c, 16);
+    interp_config_set_mask(&c, 0, 7);
+    interp_set_config(interp0, 0, &c);
+    c = interp_default_config();
+    interp_set_config(interp0, 1, &c);
+
+    interp0->accum[0] = (step >> 1) + o * step;
+    interp0->accum[1] = 0;
+    interp0->base[0]  = step;
+    interp0->base[1]  = 0;
+    interp0->base[2]  = reinterpret_cast<uintptr_t>(row);
+    for (int i = 0; i < count; i++) {
+        uint8_t k = *reinterpret_cast<const uint8_t *>(interp0->pop[2]);
+        if (k) dst[i] = pal[k];
+    }
+}
+#endif
+
+// ── Dispatch ──────────────────────────────────────────────────────────────────
+
+void blit_sprite_row(const uint8_t *row, int bpp, int n, int d, int o, int count,
+                     const uint16_t *pal, uint16_t *dst) {
+#if BLIT_INTERP
+    if (bpp == 8 && n >= 1 && n <= BLIT_MAP_MAX && d >= 1 && d <= BLIT_MAP_MAX) {
+        blit_sprite_row_interp(row, bpp, n, d, o, count, pal, dst);
+        return;
+    }
+#endif
+    blit_sprite_row_c(row, bpp, n, d, o, count, pal, dst);
+}
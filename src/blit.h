@@ -0,0 +1,51 @@
+#pragma once
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ── Fractional scaling ───────────────────────────────────────────────────────
+// Nearest-neighbour stretching of n source pixels over d output pixels goes
+// through a map: map[i] is the source index for output pixel i, sampled at
+// pixel centres in 16.16 fixed point.  Maps are built once per (n, d) and
+// cached, so the per-pixel cost is one table lookup.  A map stays valid
+// until BLIT_MAP_SLOTS other (n, d) pairs have been asked for since.
+
+#define BLIT_MAP_SLOTS  8
+#define BLIT_MAP_MAX    256     // largest n and d
+
+const uint8_t *blit_map(int n, int d);
+
+// Output pixels [*o0, *o1] of a d-pixel map that sample source [s0, s1];
+// *o1 < *o0 when none do (shrinking can skip source pixels)
+void blit_map_span(const uint8_t *map, int d, int s0, int s1, int *o0, int *o1);
+
+// ── Sprite rows ──────────────────────────────────────────────────────────────
+// The scene's per-pixel loop.  Output pixels [o, o+count) of n packed
+// palette indices (bpp 1, 4 or 8, rows padded to a byte, leftmost pixel in
+// the high bits) stretched over d go through pal (RGB565 big-endian) into
+// dst, except index 0, which is transparent and leaves dst alone.  With
+// BLIT_INTERP=1 (CMake -DTAMAGOTCHI_INTERP=ON) 8-bpp rows step through the
+// source on INTERP0 of the calling core instead of reading the cached map;
+// output is identical either way.  The interpolator is not saved, so this
+// must not be called from interrupt handlers.
+
+#ifndef BLIT_INTERP
+#define BLIT_INTERP 0
+#endif
+
+void blit_sprite_row(const uint8_t *row, int bpp, int n, int d, int o, int count,
+                     const uint16_t *pal, uint16_t *dst);
+
+// The backends by name, for the benchmarks
+void blit_sprite_row_c(const uint8_t *row, int bpp, int n, int d, int o, int count,
+                       const uint16_t *pal, uint16_t *dst);
+#if BLIT_INTERP
+void blit_sprite_row_interp(const uint8_t *row, int bpp, int n, int d, int o, int count,
+                            const uint16_t *pal, uint16_t *dst);    // 8 bpp only
+#endif
+
+#ifdef __cplusplus
+}
+#endif
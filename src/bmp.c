@@ -137,4 +137,4 @@ uint8_t *bmp_load_mem(const uint8_t *data, uint32_t len, int *out_w, int *out_h)
     *out_h = h;
     printf("bmp_mem: decoded %dx%d sprite (%d bpp)\n", w, h, bpp);
     return out;
-}
\ No newline at end of file
+}
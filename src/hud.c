@@ -0,0 +1,123 @@
+#include "hud.h"
+#include "scene.h"
+#include <stdio.h>
+#include <string.h>
+
+// ── Font ──────────────────────────────────────────────────────────────────────
+// 3×5 glyphs, one octal digit per row top to bottom, leftmost pixel in the
+// high bit; 4-pixel advance.  Anything else draws as a space.
+
+#define GLYPH_W   3
+#define GLYPH_H   5
+#define ADVANCE   4
+
+static const char     _glyph_chars[] = "0123456789.%MB/sRW";
+static const uint16_t _glyphs[] = {
+    075557, 026227, 071747, 071717, 055711, 074717, 074757, 071111, 075757, 075717,
+    000002, 051245, 057755, 065656, 011244, 003616, 065655, 055775,
+};
+
+// ── Layout ────────────────────────────────────────────────────────────────────
+
+#define HUD_Y      (TFT_H - HUD_H)
+#define STRIDE     ((TFT_W + 7) / 8)
+#define TEXT_Y     1
+#define BAR_Y      7
+#define BAR_H      4
+#define BAR_X      2
+#define BAR_W      (TFT_W - 2 * BAR_X)
+#define PCT_X      (TFT_W - 1 - 4 * ADVANCE)       // "100%", right-aligned
+#define RATE_X     2
+
+static const uint16_t _pal[2] = { 0, SWAP16(RGB565(200, 200, 200)) };
+
+static uint8_t _bits[STRIDE * HUD_H];
+static Layer  *_back, *_text;
+
+static char    _pct[8];
+static char    _rate[16];
+static int     _fill;
+
+// ── Drawing ───────────────────────────────────────────────────────────────────
+
+static void _fill_rect(int x, int y, int w, int h, bool on) {
+    for (int r = y; r < y + h; r++)
+        for (int c = x; c < x + w; c++) {
+            uint8_t m = 0x80 >> (c & 7);
+            if (on) _bits[r * STRIDE + (c >> 3)] |= m;
+            else    _bits[r * STRIDE + (c >> 3)] &= ~m;
+        }
+}
+
+static void _text_at(int x, int y, const char *s) {
+    for (; *s && x + GLYPH_W <= TFT_W; s++, x += ADVANCE) {
+        const char *g = strchr(_glyph_chars, *s);
+        if (!g) continue;
+        uint16_t bits = _glyphs[g - _glyph_chars];
+        for (int r = 0; r < GLYPH_H; r++)
+            for (int c = 0; c < GLYPH_W; c++)
+                if (bits & (1 << ((GLYPH_H - 1 - r) * GLYPH_W + (GLYPH_W - 1 - c))))
+                    _fill_rect(x + c, y + r, 1, 1, true);
+    }
+}
+
+// Replace the text at x if it changed, redrawing the longer of old and new
+static void _field(char *cur, size_t size, const char *want, int x) {
+    if (strcmp(cur, want) == 0) return;
+    size_t cells = strlen(cur) > strlen(want) ? strlen(cur) : strlen(want);
+    int    w     = (int)cells * ADVANCE;
+    if (x + w > TFT_W) w = TFT_W - x;
+    snprintf(cur, size, "%s", want);
+    _fill_rect(x, TEXT_Y, w, GLYPH_H, false);
+    _text_at(x, TEXT_Y, cur);
+    scene_touch_rect(_text, x, TEXT_Y, w, GLYPH_H);
+}
+
+// ── API ───────────────────────────────────────────────────────────────────────
+
+void hud_init(void) {
+    memset(_bits, 0, sizeof _bits);
+    _fill_rect(BAR_X, BAR_Y, BAR_W, 1, true);               // bar outline
+    _fill_rect(BAR_X, BAR_Y + BAR_H - 1, BAR_W, 1, true);
+    _fill_rect(BAR_X, BAR_Y, 1, BAR_H, true);
+    _fill_rect(BAR_X + BAR_W - 1, BAR_Y, 1, BAR_H, true);
+    _pct[0] = _rate[0] = '\0';
+    _fill = 0;
+
+    _back = scene_add(&(Layer){ .kind = LAYER_FILL, .visible = true, .z = 20,
+                                .y = HUD_Y, .w = TFT_W, .h = HUD_H,
+                                .colour_be = COL_BLACK });
+    _text = scene_add(&(Layer){ .kind = LAYER_SPRITE, .visible = true, .z = 21,
+                                .y = HUD_Y, .w = TFT_W, .h = HUD_H,
+                                .data = _bits, .bpp = 1, .pal_be = _pal });
+}
+
+void hud_set_used(float fraction) {
+    if (!_text) return;
+    if (fraction < 0.0f) fraction = 0.0f;
+    if (fraction > 1.0f) fraction = 1.0f;
+
+    int fill = (int)(fraction * (BAR_W - 2) + 0.5f);
+    if (fill != _fill) {
+        int lo = fill < _fill ? fill : _fill;
+        int hi = fill < _fill ? _fill : fill;
+        _fill_rect(BAR_X + 1 + lo, BAR_Y + 1, hi - lo, BAR_H - 2, fill > _fill);
+        scene_touch_rect(_text, BAR_X + 1 + lo, BAR_Y + 1, hi - lo, BAR_H - 2);
+        _fill = fill;
+    }
+
+    char s[8];
+    snprintf(s, sizeof s, "%3d%%", (int)(fraction * 100.0f + 0.5f));
+    _field(_pct, sizeof _pct, s, PCT_X);
+}
+
+void hud_set_rate(char dir, uint32_t bytes_per_s) {
+    if (!_text) return;
+    char s[16] = "";
+    if (dir) {
+        uint32_t tenths = (bytes_per_s + 50000) / 100000;
+        snprintf(s, sizeof s, "%c %lu.%luMB/s", dir,
+                 (unsigned long)(tenths / 10), (unsigned long)(tenths % 10));
+    }
+    _field(_rate, sizeof _rate, s, RATE_X);
+}
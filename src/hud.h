@@ -0,0 +1,23 @@
+#pragma once
+#include <stdint.h>
+
+// ── HUD ───────────────────────────────────────────────────────────────────────
+// A strip of HUD_H rows along the bottom of the screen, in the letterbox
+// under the character: storage fill bar with percentage, and the transfer
+// rate and direction while the host is reading or writing.  Text is a 3×5
+// 1-bpp font drawn into a 1-bpp scene layer; each setter redraws only the
+// element whose pixels changed and marks just that rectangle dirty, so an
+// unchanged HUD costs nothing per frame.
+
+#define HUD_H  12
+
+// Add the HUD's layers to the scene (after scene_init()).  Keep the strip out
+// of any scroll region: scene_scroll_area(0, TFT_H - HUD_H).
+void hud_init(void);
+
+// Used fraction of the card, 0..1
+void hud_set_used(float fraction);
+
+// Transfer rate in bytes/s and direction ('R' host reading, 'W' writing);
+// dir 0 clears the readout.  Shown to 0.1 MB/s.
+void hud_set_rate(char dir, uint32_t bytes_per_s);
@@ -4,6 +4,14 @@
 #include "sd_card.h"
 #include "bmp.h"
 #include "usb_msc.h"
+#include "sprite.h"
+#include "scene.h"
+#include "hud.h"
+#include "render.h"
+#include "sched.h"
+#ifdef TAMAGOTCHI_BENCH
+#include "bench.h"
+#endif
 #include "ff.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -11,10 +19,12 @@
 #include <stdbool.h>
 
 // ── User configuration ────────────────────────────────────────────────────────
-#define CHARACTER    "sayuri"  // which character to display
+#define CHARACTER    SPRITE_CHAR_SAYURI  // which character (sprites/<name>/) to display
 #define FRAME_MS     180          // ms per animation frame
+#define FRAME_MS_FAST 60          // TRANSFER frame time at RATE_FAST and above
 #define CHECK_EVERY  30           // re-check SD fullness every N frames
-#define MAX_FRAMES   16           // max frames per state held in RAM
+#define HUD_RATE_MS  1000         // HUD rate readout refresh
+#define LOOP_REPORT_MS 30000      // wakeup/latency/task report interval
 
 // ── Enums ─────────────────────────────────────────────────────────────────────
 typedef enum { TIER_SMALL=0, TIER_MEDIUM, TIER_LARGE, TIER_COUNT } Tier;
@@ -23,43 +33,84 @@ typedef enum { STATE_IDLE=0, STATE_TRANSFER, STATE_CONNECT, STATE_ENDTRANSFER, S
 static const char *tier_name[TIER_COUNT]   = { "SMALL", "MEDIUM", "LARGE" };
 static const char *state_name[STATE_COUNT] = { "IDLE", "TRANSFER", "CONNECT", "ENDTRANSFER" };
 
-// ── Sprites (generated by convert_sprites.sh) ─────────────────────────────────
-#ifdef __has_include
-#  if __has_include("sprites.h")
-#    include "sprites.h"
-#  else
-     typedef struct { const uint8_t *data; uint32_t len; int tier; int state; const char *character; } SpriteEntry;
-     static const SpriteEntry sprite_table[] = {};
-     static const int sprite_table_len = 0;
-#  endif
-#else
-#  include "sprites.h"
-#endif
+// ── Sprites (generated by tools/spritepack) ───────────────────────────────────
+#include "sprites.h"
 
 // ── Frame cache ───────────────────────────────────────────────────────────────
-typedef struct { uint8_t *pixels; int w, h; } Frame;
-static Frame _frames[MAX_FRAMES];
-static int   _frame_count  = 0;
-static Tier  _current_tier = (Tier)-1;
+// The player keeps the current frame as 8-bit indices and steps through the
+// sequence by applying deltas from flash, reporting what changed.
+static SpritePlayer _player;
+static Tier         _current_tier = (Tier)-1;
 
 static void free_frames(void) {
-    for (int i = 0; i < _frame_count; i++) {
-        free(_frames[i].pixels);
-        _frames[i].pixels = NULL;
-    }
-    _frame_count = 0;
+    sprite_player_clear(&_player);
 }
 
 // ── SD fullness ───────────────────────────────────────────────────────────────
+// FatFs keeps the free cluster count in _fs.free_clst from mount to mount,
+// taken from FSINFO on FAT32 when that is valid.  Otherwise it has to be
+// counted from the whole FAT, thousands of sectors on a large card.  On
+// FAT16/32 that count is taken FREE_SCAN_SECTORS sectors per call, and the
+// sd task sleeps FREE_SCAN_GAP_US between calls to leave the bus to USB and
+// the display.  The result goes back into _fs.free_clst, so it is counted
+// once per mount.  FAT12 volumes are small enough for one f_getfree().
+#define FREE_SCAN_SECTORS  4
+#define FREE_SCAN_GAP_US   1000
+
+static FATFS _fs;   // file scope so the sd task can remount it and scan its FAT
+
+typedef struct {
+    uint32_t sector;    // next FAT sector to read
+    uint32_t entry;     // first entry in it
+    uint32_t free;      // free clusters so far
+    bool     ok;
+} FreeScan;
+
+static bool sd_free_known(void) {
+    return _fs.free_clst <= _fs.n_fatent - 2;
+}
+
+// From the free cluster count FatFs holds; 0 when it is not known
 static float sd_used_fraction(void) {
+    if (!sd_free_known()) return 0.0f;
+    uint32_t total = (_fs.n_fatent - 2) * _fs.csize;
+    uint32_t used  = total - _fs.free_clst * _fs.csize;
+    return total ? (float)used / (float)total : 0.0f;
+}
+
+// Have FatFs count the free clusters in one go
+static void sd_getfree(void) {
     FATFS *fsp; DWORD free_clust;
     mutex_enter_blocking(&sd_mutex);
-    FRESULT r = f_getfree("", &free_clust, &fsp);
+    f_getfree("", &free_clust, &fsp);
     mutex_exit(&sd_mutex);
-    if (r != FR_OK) return 0.0f;
-    uint32_t total = (fsp->n_fatent - 2) * fsp->csize;
-    uint32_t used  = total - free_clust * fsp->csize;
-    return total ? (float)used / (float)total : 0.0f;
+}
+
+static void free_scan_begin(FreeScan *s) {
+    s->sector = _fs.fatbase;
+    s->entry  = 0;
+    s->free   = 0;
+    s->ok     = true;
+}
+
+// Count the next few FAT sectors; true once the whole FAT is done
+static bool free_scan_step(FreeScan *s) {
+    static uint8_t buf[512];
+    bool fat32 = _fs.fs_type == FS_FAT32;
+    int  per   = fat32 ? 128 : 256;
+    for (int k = 0; k < FREE_SCAN_SECTORS && s->entry < _fs.n_fatent; k++) {
+        if (!sd_read_blocks(s->sector++, buf, 1)) {
+            s->ok = false;
+            return true;
+        }
+        for (int i = 0; i < per && s->entry < _fs.n_fatent; i++, s->entry++) {
+            const uint8_t *e = buf + (fat32 ? i * 4 : i * 2);
+            uint32_t v = fat32 ? (e[0] | e[1] << 8 | e[2] << 16 | (uint32_t)(e[3] & 0x0F) << 24)
+                               : (uint32_t)(e[0] | e[1] << 8);
+            if (v == 0 && s->entry >= 2) s->free++;     // entries 0, 1 are reserved
+        }
+    }
+    return s->entry >= _fs.n_fatent;
 }
 
 static Tier tier_for(float f) {
@@ -73,179 +124,434 @@ static void load_frames(Tier t, AnimState s) {
     free_frames();
     _current_tier = t;
 
-    // Fallback order: requested state → IDLE
-    AnimState state_order[2] = { s, STATE_IDLE };
-    int n_states = (s == STATE_IDLE) ? 1 : 2;
-
-    // Fallback order: requested tier → nearest smaller → nearest larger
-    Tier tier_order[TIER_COUNT];
-    int  n_tiers = 0;
-    tier_order[n_tiers++] = t;
-    for (int d = 1; d < TIER_COUNT; d++) {
-        if ((int)t - d >= 0)         tier_order[n_tiers++] = (Tier)(t - d);
-        if ((int)t + d < TIER_COUNT) tier_order[n_tiers++] = (Tier)(t + d);
-    }
+    // Fallback (requested state → IDLE, requested tier → nearest smaller →
+    // nearest larger) is resolved at build time, so this is one lookup.
+    const SpriteSeq *q = &sprite_index[CHARACTER][s][t];
+    for (int i = 0; i < q->count; i++)
+        if (!sprite_player_add(&_player, &sprite_table[q->first + i])) break;
 
-    for (int si = 0; si < n_states && _frame_count == 0; si++) {
-        for (int ti = 0; ti < n_tiers && _frame_count == 0; ti++) {
-            for (int i = 0; i < sprite_table_len && _frame_count < MAX_FRAMES; i++) {
-                const SpriteEntry *e = &sprite_table[i];
-                if (e->tier  != (int)tier_order[ti])  continue;
-                if (e->state != (int)state_order[si]) continue;
-                if (strcmp(e->character, CHARACTER)   != 0) continue;
-                int w, h;
-                uint8_t *px = bmp_load_mem(e->data, e->len, &w, &h);
-                if (px) {
-                    _frames[_frame_count].pixels = px;
-                    _frames[_frame_count].w = w;
-                    _frames[_frame_count].h = h;
-                    _frame_count++;
-                }
-            }
-            if (_frame_count > 0) {
-                printf("%s %s_%s: %d frame(s)%s\n",
-                    CHARACTER, tier_name[tier_order[ti]], state_name[state_order[si]],
-                    _frame_count,
-                    (tier_order[ti] != t || state_order[si] != s) ? " [fallback]" : "");
-            }
-        }
+    if (_player.count > 0) {
+        printf("%s %s_%s: %d frame(s)%s\n",
+            sprite_char_name[CHARACTER], tier_name[q->tier], state_name[q->state],
+            _player.count,
+            (q->tier != t || q->state != s) ? " [fallback]" : "");
+    } else {
+        printf("%s: no sprites found, using placeholder\n", sprite_char_name[CHARACTER]);
     }
-
-    if (_frame_count == 0)
-        printf("%s: no sprites found, using placeholder\n", CHARACTER);
 }
 
-// ── Placeholder ───────────────────────────────────────────────────────────────
-static uint8_t _placeholder_buf[16*16*2];
+// ── Scene ─────────────────────────────────────────────────────────────────────
+// Dotted backdrop, the character on top, and a solid square in the tier's
+// colour standing in when there are no sprites, and the HUD along the
+// bottom.  Everything above the HUD is one hardware scroll region; while
+// idle the scene bobs through _bob so the character appears to walk, at the
+// cost of one exposed band per step.
+static Layer *_bg, *_chr, *_placeholder;
 
-static void make_placeholder(Tier t) {
-    uint16_t cols[TIER_COUNT] = {
-        SWAP16(RGB565(  0, 210, 220)),
-        SWAP16(RGB565(255, 140,   0)),
-        SWAP16(RGB565(220,  30, 180)),
-    };
-    uint16_t c = cols[t];
-    for (int i = 0; i < 16*16*2; i += 2) {
-        _placeholder_buf[i]   = (c >> 8) & 0xFF;
-        _placeholder_buf[i+1] =  c & 0xFF;
-    }
+static const uint16_t _placeholder_col[TIER_COUNT] = {
+    SWAP16(RGB565(  0, 210, 220)),
+    SWAP16(RGB565(255, 140,   0)),
+    SWAP16(RGB565(220,  30, 180)),
+};
+
+#define BG_TILE 16
+#define BG_DOT  SWAP16(RGB565(40, 40, 60))
+static uint16_t _bg_tile[BG_TILE * BG_TILE];
+
+static const int8_t _bob[8] = { 0, 1, 2, 1, 0, -1, -2, -1 };
+
+static void scene_setup(void) {
+    _bg_tile[ 3 * BG_TILE +  5] = BG_DOT;
+    _bg_tile[11 * BG_TILE + 13] = BG_DOT;
+
+    scene_init();
+    _bg  = scene_add(&(Layer){ .kind = LAYER_TILE, .visible = true, .scrolls = true,
+                               .z = 0, .w = BG_TILE, .h = BG_TILE,
+                               .data = (const uint8_t *)_bg_tile });
+    _placeholder = scene_add(&(Layer){ .kind = LAYER_FILL, .scrolls = true, .z = 10,
+                                       .y = (TFT_H - TFT_W) / 2, .w = TFT_W, .h = TFT_W });
+    _chr = scene_add(&(Layer){ .kind = LAYER_SPRITE, .scrolls = true, .z = 10 });
+    hud_init();
+    scene_scroll_area(0, TFT_H - HUD_H);
 }
 
 // ── USB transfer tracking ─────────────────────────────────────────────────────
+// Any write counts as a transfer.  Hosts poll the card with small reads
+// while idle, so reads only start one once the read rate passes
+// READ_MIN_RATE, and only keep it going while the rate stays at
+// READ_EXIT_RATE or more: polling alone lets it end.
+// The TRANSFER animation speeds up with throughput, from FRAME_MS at
+// RATE_SLOW to FRAME_MS_FAST at RATE_FAST.
 #define MSC_IDLE_TIMEOUT_MS 1500
-static volatile bool     _msc_write_active  = false;
-static volatile uint32_t _msc_last_write_ms = 0;
+#define READ_MIN_RATE   (64 * 1024)
+#define READ_EXIT_RATE  (16 * 1024)
+#define RATE_SLOW       (100 * 1000)
+#define RATE_FAST       (1000 * 1000)
 
-void notify_msc_write(void) {
-    _msc_write_active  = true;
-    _msc_last_write_ms = to_ms_since_boot(get_absolute_time());
+static int transfer_frame_ms(uint32_t rate) {
+    if (rate <= RATE_SLOW) return FRAME_MS;
+    if (rate >= RATE_FAST) return FRAME_MS_FAST;
+    return FRAME_MS - (int)((uint64_t)(FRAME_MS - FRAME_MS_FAST) * (rate - RATE_SLOW) /
+                            (RATE_FAST - RATE_SLOW));
 }
 
-// ── Main ──────────────────────────────────────────────────────────────────────
-static FATFS _fs;   // file scope so remount handler can reuse it
+// ── Display QoS ───────────────────────────────────────────────────────────────
+// The display shares spi0 with the card, so while the card is saturated
+// every millisecond the display holds the bus is one the host waits for.
+// Then the frame delay stretches until the display's bus time is at most
+// QOS_DISPLAY_PCT of it; the DMA runs during the delay, so that is the whole
+// frame.  Bus time is counted at the clock the display really gets
+// (tft_bus_hz()).  The animation slows rather than skipping
+// frames, so each update stays one small delta.  Saturated means an MSC
+// load of QOS_BUSY_PCT or more; full rate returns as soon as the load drops.
+#define QOS_DISPLAY_PCT   10
+#define QOS_BUSY_PCT      30
+#define QOS_MAX_FRAME_MS  2000
 
-int main(void) {
-    stdio_init_all();
-    sleep_ms(200);
-    printf("Tamagotchi starting — character: %s\n", CHARACTER);
+static uint32_t _bus_us;        // EWMA of the display's bus time per frame
 
-    tft_init();
-    tft_fill(COL_BLACK);
+static void qos_rendered(uint32_t us) {
+    int32_t r = (int32_t)_bus_us;
+    r += ((int32_t)us - r) / 4;
+    _bus_us = (uint32_t)r;
+}
 
-    bool sd_ok = sd_init();
-    if (sd_ok) {
-        FRESULT r = f_mount(&_fs, "", 1);
-        sd_ok = (r == FR_OK);
-        if (!sd_ok) printf("FatFs mount failed: %d\n", r);
-        else        printf("FatFs mounted\n");
-    } else {
-        printf("SD init failed\n");
-        tft_fill(SWAP16(RGB565(180, 0, 0)));
-        sleep_ms(300);
-        tft_fill(COL_BLACK);
-    }
+static int qos_frame_ms(int frame_ms, bool saturated) {
+    if (!saturated) return frame_ms;
+    uint32_t min_ms = _bus_us * 100 / QOS_DISPLAY_PCT / 1000;
+    if (min_ms > QOS_MAX_FRAME_MS) min_ms = QOS_MAX_FRAME_MS;
+    return (int)min_ms > frame_ms ? (int)min_ms : frame_ms;
+}
 
-    usb_msc_init();
+// ── Tasks ─────────────────────────────────────────────────────────────────────
+// Everything on core 0 runs as a cooperative task (sched.h), most urgent
+// first:
+//   usb    TinyUSB and the display's DMA feed, on every USB interrupt or
+//          composed band and every MSC_RATE_TICK_MS for the rate estimate
+//   sd     FatFs upkeep: remount after a write transfer, free-space scan
+//   anim   transfer tracking and the animation, in two steps per frame
+//   stats  the periodic report
+// FatFs calls only happen in the sd task; the anim task asks for them
+// through the request flags below and picks up the result.
 
-    // ── State machine ──────────────────────────────────────────────────────────
-    AnimState anim_state   = STATE_CONNECT;
-    Tier      tier         = TIER_SMALL;
-    int       frame_idx    = 0;
-    int       tick         = 0;
-    bool      first_draw   = true;
-    bool      one_shot_done = false;
-    bool      was_transferring = false;
+static bool  _sd_ok;
+static bool  _remount_req, _check_req;     // anim → sd
+static bool  _scanning;
+static bool  _used_new;                    // sd → anim: _used is fresh
+static float _used;
 
-    load_frames(tier, anim_state);
+static bool _usb_ready(void) {
+    return usb_msc_pending() || render_pending();
+}
 
+static void usb_task(Task *t) {
+    TASK_BEGIN(t);
     while (true) {
         usb_msc_task();
-        uint32_t now_ms = to_ms_since_boot(get_absolute_time());
+        render_poll();
+        TASK_SLEEP(t, MSC_RATE_TICK_MS * 1000);
+    }
+    TASK_END(t);
+}
+
+// Not while scanning: the scan paces itself and checks for a remount
+static bool _sd_ready(void) {
+    return !_scanning && (_remount_req || _check_req);
+}
 
-        // ── Transfer detection ─────────────────────────────────────────────────
-        bool is_transferring = _msc_write_active &&
-            (now_ms - _msc_last_write_ms) < MSC_IDLE_TIMEOUT_MS;
-
-        if (!was_transferring && is_transferring &&
-             anim_state != STATE_TRANSFER) {
-            anim_state = STATE_TRANSFER;
-            frame_idx = 0; first_draw = true; one_shot_done = false;
-            load_frames(tier, STATE_TRANSFER);
-        } else if (was_transferring && !is_transferring) {
-            _msc_write_active = false;
+static void sd_task(Task *t) {
+    static FreeScan scan;
+    TASK_BEGIN(t);
+    while (true) {
+        TASK_WAIT(t);
+        if (_remount_req) {
             // Remount FatFs so its FAT cache reflects what the host just wrote
-            if (sd_ok) {
+            _remount_req = false;
+            if (_sd_ok) {
                 mutex_enter_blocking(&sd_mutex);
                 f_unmount("");
-                sd_ok = (f_mount(&_fs, "", 1) == FR_OK);
                 mutex_exit(&sd_mutex);
-                printf("FatFs remounted after transfer: %s\n", sd_ok ? "ok" : "fail");
+                TASK_YIELD(t);
+                mutex_enter_blocking(&sd_mutex);
+                _sd_ok = (f_mount(&_fs, "", 1) == FR_OK);
+                mutex_exit(&sd_mutex);
+                printf("FatFs remounted after transfer: %s\n", _sd_ok ? "ok" : "fail");
+                _check_req = true;
+                TASK_YIELD(t);
             }
-            anim_state = STATE_ENDTRANSFER;
-            frame_idx = 0; first_draw = true; one_shot_done = false;
-            load_frames(tier, STATE_ENDTRANSFER);
         }
-        was_transferring = is_transferring;
-
-        // ── Tier check (only while idle) ───────────────────────────────────────
-        if (anim_state == STATE_IDLE && tick % CHECK_EVERY == 0) {
-            Tier new_tier = tier_for(sd_ok ? sd_used_fraction() : 0.0f);
-            if (new_tier != tier) {
-                tier = new_tier;
-                frame_idx = 0; first_draw = true;
-                load_frames(tier, STATE_IDLE);
+        if (_check_req && _sd_ok && !sd_free_known()) {
+            if (_fs.fs_type == FS_FAT12) {
+                sd_getfree();
+            } else {
+                _scanning = true;
+                free_scan_begin(&scan);
+                while (!free_scan_step(&scan) && !_remount_req)
+                    TASK_SLEEP(t, FREE_SCAN_GAP_US);
+                _scanning = false;
+                if (_remount_req) continue;     // the card changed under the scan
+                if (scan.ok) _fs.free_clst = scan.free;
             }
         }
-
-        // ── Play-once: CONNECT / ENDTRANSFER → IDLE on last frame ─────────────
-        int  n_frames    = _frame_count > 0 ? _frame_count : 1;
-        bool is_one_shot = (anim_state == STATE_CONNECT ||
-                            anim_state == STATE_ENDTRANSFER);
-        if (is_one_shot && !one_shot_done && frame_idx >= n_frames - 1 && tick > 0) {
-            one_shot_done = true;
-            anim_state    = STATE_IDLE;
-            frame_idx     = 0; first_draw = true;
-            load_frames(tier, STATE_IDLE);
+        if (_check_req && _sd_ok) {
+            _used = sd_used_fraction();
+            _used_new = true;
         }
+        _check_req = false;
+    }
+    TASK_END(t);
+}
+
+// ── Animation ─────────────────────────────────────────────────────────────────
+static AnimState _state = STATE_CONNECT;
+static Tier      _tier  = TIER_SMALL;
+static int       _frame_idx;
+static int       _tick;
+static bool      _first_draw = true;
+static bool      _one_shot_done;
+static bool      _was_transferring;
+static bool      _writing, _reading;
+static int       _bob_at;                   // scroll offset shown
+static bool      _wrote;                    // this transfer included writes
+static uint32_t  _hud_ms;
+static MscStats  _start[MSC_DIR_COUNT];     // counters when the transfer began
+static uint32_t  _start_ms;
+static uint32_t  _transfer_bus_us;          // display bus time since then
+static int       _throttled;                // frames QoS stretched since then
+static RenderStats _rs_start;               // render counters then
+static RenderStats _rs_last;                // and at the last frame drawn
 
-        // ── Draw ───────────────────────────────────────────────────────────────
-        if (_frame_count > 0) {
-            Frame *f = &_frames[frame_idx % _frame_count];
-            tft_blit_scaled(f->pixels, f->w, f->h, first_draw);
+static void set_state(AnimState s) {
+    _state = s;
+    _frame_idx = 0; _first_draw = true; _one_shot_done = false;
+    load_frames(_tier, s);
+}
+
+static void transfer_step(uint32_t now_ms) {
+    _writing = usb_msc_active(MSC_DIR_WRITE, MSC_IDLE_TIMEOUT_MS);
+    _reading = usb_msc_active(MSC_DIR_READ, MSC_IDLE_TIMEOUT_MS) &&
+               usb_msc_rate(MSC_DIR_READ) >= (_was_transferring ? READ_EXIT_RATE
+                                                                : READ_MIN_RATE);
+    bool is_transferring = _writing || _reading;
+
+    if (!_was_transferring && is_transferring) {
+        for (int d = 0; d < MSC_DIR_COUNT; d++) usb_msc_stats(d, &_start[d]);
+        _wrote = false;
+        _start_ms = now_ms; _transfer_bus_us = 0; _throttled = 0;
+        render_stats(&_rs_start);
+        if (_state != STATE_TRANSFER) set_state(STATE_TRANSFER);
+    }
+    _wrote |= _writing;
+
+    if (_was_transferring && !is_transferring) {
+        MscStats rd, wr;
+        usb_msc_stats(MSC_DIR_READ, &rd);
+        usb_msc_stats(MSC_DIR_WRITE, &wr);
+        uint32_t elapsed_ms = now_ms - _start_ms;
+        printf("Transfer done: read %lu KB, wrote %lu KB, peak %lu/%lu KB/s, %lu error(s)\n",
+               (unsigned long)((rd.bytes - _start[MSC_DIR_READ].bytes) / 1024),
+               (unsigned long)((wr.bytes - _start[MSC_DIR_WRITE].bytes) / 1024),
+               (unsigned long)(rd.peak / 1024), (unsigned long)(wr.peak / 1024),
+               (unsigned long)(rd.errors - _start[MSC_DIR_READ].errors +
+                               wr.errors - _start[MSC_DIR_WRITE].errors));
+        RenderStats rs;
+        render_stats(&rs);
+        printf("  display: %lu ms of %lu ms on the bus (%lu%%), %d throttled, "
+               "%lu dropped, %lu stalled frame(s)\n",
+               (unsigned long)(_transfer_bus_us / 1000), (unsigned long)elapsed_ms,
+               (unsigned long)(elapsed_ms ? _transfer_bus_us / 10 / elapsed_ms : 0), _throttled,
+               (unsigned long)(rs.dropped - _rs_start.dropped),
+               (unsigned long)(rs.stalls - _rs_start.stalls));
+
+        if (!_wrote) {
+            // Read-only: nothing on the card changed
+            set_state(STATE_IDLE);
         } else {
-            make_placeholder(tier);
-            tft_blit_scaled(_placeholder_buf, 16, 16, first_draw);
+            _remount_req = true;
+            set_state(STATE_ENDTRANSFER);
+        }
+    }
+    _was_transferring = is_transferring;
+}
+
+// Returns the delay until the next frame, in ms
+static int frame_step(uint32_t now_ms) {
+    bool is_transferring = _writing || _reading;
+
+    // ── Frame handoff ──────────────────────────────────────────────────────────
+    // The scene only changes once the last frame is composed and sent;
+    // if it isn't, this frame is dropped and the animation waits.
+    bool draw = render_begin();
+    if (draw) {
+        RenderStats rs;
+        render_stats(&rs);
+        uint32_t spent = rs.bus_us - _rs_last.bus_us;
+        qos_rendered(spent);
+        if (is_transferring) _transfer_bus_us += spent;
+        _rs_last = rs;
+    }
+
+    // ── HUD rate readout ───────────────────────────────────────────────────────
+    if (draw && now_ms - _hud_ms >= HUD_RATE_MS) {
+        if (_writing)      hud_set_rate('W', usb_msc_rate(MSC_DIR_WRITE));
+        else if (_reading) hud_set_rate('R', usb_msc_rate(MSC_DIR_READ));
+        else               hud_set_rate(0, 0);
+        _hud_ms = now_ms;
+    }
+
+    // ── Tier check ─────────────────────────────────────────────────────────────
+    // Asked for while idle, counted by the sd task; the tier changes at once
+    // when idle, otherwise with the next animation loaded.
+    if (draw && _state == STATE_IDLE && _tick % CHECK_EVERY == 0) _check_req = true;
+    if (draw && _used_new) {
+        _used_new = false;
+        hud_set_used(_used);
+        Tier new_tier = tier_for(_used);
+        if (new_tier != _tier) {
+            _tier = new_tier;
+            if (_state == STATE_IDLE) {
+                _frame_idx = 0; _first_draw = true;
+                load_frames(_tier, STATE_IDLE);
+            }
         }
-        first_draw = false;
-        frame_idx  = (frame_idx + 1) % n_frames;
-        tick       = (tick + 1) % (CHECK_EVERY * 100000);
-
-        // ── Frame delay ────────────────────────────────────────────────────────
-        absolute_time_t deadline = make_timeout_time_ms(FRAME_MS);
-        while (!time_reached(deadline)) {
-            usb_msc_task();
-            sleep_us(100);
+    }
+
+    // ── Play-once: CONNECT / ENDTRANSFER → IDLE on last frame ─────────────────
+    int  n_frames    = _player.count > 0 ? _player.count : 1;
+    bool is_one_shot = (_state == STATE_CONNECT || _state == STATE_ENDTRANSFER);
+    if (is_one_shot && !_one_shot_done && _frame_idx >= n_frames - 1 && _tick > 0) {
+        set_state(STATE_IDLE);
+        _one_shot_done = true;
+    }
+
+    // ── Draw ───────────────────────────────────────────────────────────────────
+    // A dropped frame changes nothing and is shown next time instead
+    if (draw) {
+        if (_player.count > 0) {
+            // Only the bands the delta touched are re-rendered; a still
+            // frame costs nothing after the first draw.
+            SpriteRect r;
+            sprite_player_seek(&_player, _frame_idx, &r);
+            if (_first_draw) {
+                scene_show(_placeholder, false);
+                scene_set_sprite(_chr, _player.canvas, 8, _player.palette,
+                                 _player.w, _player.h);
+                scene_fit_box(_chr, _player.fw, _player.fh, _player.x, _player.y,
+                              TFT_FIT_ASPECT);
+                // Fitted as if unscrolled: carry it along with the scene's bob
+                scene_move(_chr, _chr->x, _chr->y - _bob_at);
+                scene_show(_chr, true);
+            } else {
+                scene_touch_rect(_chr, r.x, r.y, r.w, r.h);
+            }
+        } else if (_first_draw) {
+            scene_show(_chr, false);
+            scene_set_colour(_placeholder, _placeholder_col[_tier]);
+            scene_show(_placeholder, true);
         }
+        int want = _state == STATE_IDLE ? _bob[_tick % 8] : 0;
+        scene_scroll(want - _bob_at);
+        _bob_at = want;
+        render_submit();
+        _first_draw = false;
+        _frame_idx  = (_frame_idx + 1) % n_frames;
+        _tick       = (_tick + 1) % (CHECK_EVERY * 100000);
     }
-    return 0;
-}
\ No newline at end of file
+
+    // ── Frame delay ────────────────────────────────────────────────────────────
+    int frame_ms = FRAME_MS;
+    if (_state == STATE_TRANSFER)
+        frame_ms = transfer_frame_ms(usb_msc_rate(_writing ? MSC_DIR_WRITE : MSC_DIR_READ));
+    int qos_ms = qos_frame_ms(frame_ms, is_transferring && usb_msc_load() >= QOS_BUSY_PCT);
+    if (qos_ms > frame_ms) _throttled++;
+    return qos_ms;
+}
+
+// Transfer tracking may load a new animation, so USB gets a turn before
+// the frame is drawn
+static void anim_task(Task *t) {
+    static int frame_ms;
+    TASK_BEGIN(t);
+    while (true) {
+        transfer_step(to_ms_since_boot(get_absolute_time()));
+        TASK_YIELD(t);
+        frame_ms = frame_step(to_ms_since_boot(get_absolute_time()));
+        TASK_SLEEP(t, frame_ms * 1000);
+    }
+    TASK_END(t);
+}
+
+// ── Report ────────────────────────────────────────────────────────────────────
+
+static void stats_task(Task *t) {
+    static uint32_t last_ms, last_wakeups, last_count, last_sum;
+    TASK_BEGIN(t);
+    while (true) {
+        TASK_SLEEP(t, LOOP_REPORT_MS * 1000);
+        uint32_t now_ms = to_ms_since_boot(get_absolute_time());
+        uint32_t wakeups = sched_wakeups();
+        MscLatency l;
+        usb_msc_latency(&l);
+        uint32_t n = l.count - last_count;
+        if (last_ms) {
+            printf("loop: %lu wakeups/s, USB latency avg %lu us max %lu us (%lu events)\n",
+                   (unsigned long)((uint64_t)(wakeups - last_wakeups) * 1000 / (now_ms - last_ms)),
+                   (unsigned long)(n ? (l.sum_us - last_sum) / n : 0),
+                   (unsigned long)l.max_us, (unsigned long)n);
+            sched_report();
+        }
+        last_ms = now_ms; last_wakeups = wakeups; last_count = l.count; last_sum = l.sum_us;
+    }
+    TASK_END(t);
+}
+
+static Task _usb_task   = { .name = "usb",   .prio = 0, .fn = usb_task,   .ready = _usb_ready };
+static Task _sd_task    = { .name = "sd",    .prio = 1, .fn = sd_task,    .ready = _sd_ready };
+static Task _anim_task  = { .name = "anim",  .prio = 2, .fn = anim_task };
+static Task _stats_task = { .name = "stats", .prio = 3, .fn = stats_task };
+
+// ── Main ──────────────────────────────────────────────────────────────────────
+
+int main(void) {
+    stdio_init_all();
+    sleep_ms(200);
+    printf("Tamagotchi starting — character: %s\n", sprite_char_name[CHARACTER]);
+
+    tft_init();
+    printf("Panel %s: %d B/frame, %lu fps full-screen at %.2f MHz\n", TFT_PANEL_NAME,
+           TFT_FRAME_BYTES(TFT_BPP), (unsigned long)TFT_FULL_FPS(tft_bus_hz(), TFT_BPP),
+           tft_bus_hz() / 1e6);
+    tft_fill(COL_BLACK);
+    scene_setup();
+    render_init();
+
+#ifdef TAMAGOTCHI_BENCH
+    bench_sprite_decode(sprite_table, sprite_table_len);
+    bench_blit_stretch();
+#endif
+
+    _sd_ok = sd_init();
+    if (_sd_ok) {
+        FRESULT r = f_mount(&_fs, "", 1);
+        _sd_ok = (r == FR_OK);
+        if (!_sd_ok) printf("FatFs mount failed: %d\n", r);
+        else         printf("FatFs mounted\n");
+        _check_req = _sd_ok;
+    } else {
+        printf("SD init failed\n");
+        tft_fill(SWAP16(RGB565(180, 0, 0)));
+        sleep_ms(300);
+        tft_fill(COL_BLACK);
+    }
+
+    usb_msc_init();
+
+    sprite_player_clear(&_player);
+    load_frames(_tier, _state);
+
+    sched_add(&_usb_task);
+    sched_add(&_sd_task);
+    sched_add(&_anim_task);
+    sched_add(&_stats_task);
+    sched_run();
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+// ── Panels ───────────────────────────────────────────────────────────────────
+// One descriptor per controller/glass combination, chosen at build time with
+// TFT_PANEL (CMake -DTAMAGOTCHI_PANEL=...).  Every field is a preprocessor
+// constant, so geometry, GRAM offsets and clip bounds fold into the drawing
+// code and nothing is looked up at run time.
+//
+//   TFT_W, TFT_H        visible size, portrait
+//   TFT_XOFF, TFT_YOFF  where the glass sits in GRAM
+//   TFT_GRAM_H          controller rows, visible or not (scroll definition)
+//   TFT_MADCTL          memory access control for that orientation
+//   TFT_SPI_HZ          SPI peripheral clock asked for (clk_peri over an even
+//                       divider, so it may come out lower)
+//   TFT_MAX_HZ          fastest write clock the panel takes (PIO transport)
+//   TFT_COLMOD_16/12    COLMOD for RGB565 / RGB444
+//   TFT_INIT_SEQ        init script in the command-list format of st7735.c
+//                       (cmd, n | CL_DELAY, data, [delay ms hi, lo]),
+//                       ending before COLMOD, which the driver adds
+
+#define PANEL_ST7735_80x160    1    // 0.96" IPS, the board this was built on
+#define PANEL_ST7789_240x240   2    // 1.3"/1.54" square IPS
+#define PANEL_ST7789_135x240   3    // 1.14" IPS
+
+#ifndef TFT_PANEL
+#define TFT_PANEL PANEL_ST7735_80x160
+#endif
+
+#if TFT_PANEL == PANEL_ST7735_80x160
+#define TFT_PANEL_NAME  "ST7735 80x160"
+#define TFT_W           80
+#define TFT_H           160
+#define TFT_XOFF        26
+#define TFT_YOFF        1
+#define TFT_GRAM_H      162
+#define TFT_MADCTL      0x08        // no mirroring, BGR glass
+#define TFT_SPI_HZ      40000000
+#define TFT_MAX_HZ      62500000
+#define TFT_COLMOD_16   0x05
+#define TFT_COLMOD_12   0x03
+#define TFT_INIT_SEQ                                                          \
+    0x01, CL_DELAY, 0, 150,                         /* SWRESET */             \
+    0x11, CL_DELAY, 500 >> 8, 500 & 0xFF,           /* SLPOUT  */             \
+    0xB1, 3, 0x01, 0x2C, 0x2D,                      /* FRMCTR1 */             \
+    0xB2, 3, 0x01, 0x2C, 0x2D,                      /* FRMCTR2 */             \
+    0xB3, 6, 0x01, 0x2C, 0x2D, 0x01, 0x2C, 0x2D,    /* FRMCTR3 */             \
+    0xB4, 1, 0x07,                                  /* INVCTR  */             \
+    0xC0, 3, 0xA2, 0x02, 0x84,                      /* PWCTR1  */             \
+    0xC1, 1, 0xC5,                                  /* PWCTR2  */             \
+    0xC2, 2, 0x0A, 0x00,                            /* PWCTR3  */             \
+    0xC3, 2, 0x8A, 0x2A,                            /* PWCTR4  */             \
+    0xC4, 2, 0x8A, 0xEE,                            /* PWCTR5  */             \
+    0xC5, 1, 0x0E,                                  /* VMCTR1  */             \
+    0x21, 0,                                        /* INVON   */
+
+#elif TFT_PANEL == PANEL_ST7789_240x240 || TFT_PANEL == PANEL_ST7789_135x240
+#if TFT_PANEL == PANEL_ST7789_240x240
+#define TFT_PANEL_NAME  "ST7789 240x240"
+#define TFT_W           240
+#define TFT_H           240
+#define TFT_XOFF        0
+#define TFT_YOFF        0
+#else
+#define TFT_PANEL_NAME  "ST7789 135x240"
+#define TFT_W           135
+#define TFT_H           240
+#define TFT_XOFF        52
+#define TFT_YOFF        40
+#endif
+#define TFT_GRAM_H      320
+#define TFT_MADCTL      0x00        // no mirroring, RGB glass
+#define TFT_SPI_HZ      62500000
+#define TFT_MAX_HZ      62500000
+#define TFT_COLMOD_16   0x55
+#define TFT_COLMOD_12   0x53
+#define TFT_INIT_SEQ                                                          \
+    0x01, CL_DELAY, 0, 150,                         /* SWRESET */             \
+    0x11, CL_DELAY, 0, 120,                         /* SLPOUT  */             \
+    0x21, 0,                                        /* INVON   */
+
+#else
+#error "unknown TFT_PANEL"
+#endif
+
+// ── Sizing ───────────────────────────────────────────────────────────────────
+// Bytes per full frame and full frames per second the write clock allows
+#define TFT_FRAME_BYTES(bits_per_px)   (TFT_W * TFT_H * (bits_per_px) / 8)
+#define TFT_FULL_FPS(hz, bits_per_px)  ((hz) / 8 / TFT_FRAME_BYTES(bits_per_px))
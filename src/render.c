@@ -0,0 +1,158 @@
+#include "render.h"
+#include "st7735.h"
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+#if RENDER_CORE1
+#include "pico/multicore.h"
+#endif
+
+static volatile RenderStats _stats;
+
+static void _account(uint32_t pixels) {
+    _stats.pixels += pixels;
+    _stats.bus_us += (uint32_t)((uint64_t)pixels * TFT_BPP * 1000000 / tft_bus_hz());
+}
+
+#if RENDER_CORE1
+
+// ── Slot ring ─────────────────────────────────────────────────────────────────
+// Slots are filled, sent and freed strictly in order.  _head and _tail are
+// free-running; the slot for index i is _slots[i % RENDER_SLOTS].
+//   _tail ≤ _next ≤ _head:  [_tail, _next) on the wire, [_next, _head) ready
+
+typedef struct {
+    int16_t  x, y, w, h;
+    uint16_t px[RENDER_SLOT_PIXELS];
+} _Slot;
+
+static _Slot             _slots[RENDER_SLOTS];
+static volatile uint32_t _head;         // written by core 1 only
+static volatile uint32_t _tail;         // written by the DMA IRQ only
+static uint32_t          _next;         // core 0
+static volatile bool     _composing;
+
+// ── Producer: scene sink on core 1 ────────────────────────────────────────────
+
+static _Slot *_cur;
+static int    _sx, _sy, _sw, _lines;
+
+static void _push(void) {
+    _sy += _cur->h;
+    _cur = NULL;
+    __dmb();                            // slot contents before the index
+    _head = _head + 1;
+    __sev();                            // wake core 0 to send it
+}
+
+static void _sink_begin(void *ctx, int x, int y, int w, int h) {
+    (void)ctx; (void)h;
+    _sx    = x;
+    _sy    = y;
+    _sw    = w;
+    _lines = RENDER_SLOT_PIXELS / w;
+}
+
+static uint16_t *_sink_line(void *ctx) {
+    (void)ctx;
+    if (_cur && _cur->h == _lines) _push();
+    if (!_cur) {
+        if (_head - _tail == RENDER_SLOTS) {
+            _stats.stalls++;
+            while (_head - _tail == RENDER_SLOTS) tight_loop_contents();
+        }
+        __dmb();                        // the slot is free before reusing it
+        _cur = &_slots[_head % RENDER_SLOTS];
+        _cur->x = _sx;
+        _cur->y = _sy;
+        _cur->w = _sw;
+        _cur->h = 0;
+    }
+    return _cur->px + _cur->h++ * _sw;
+}
+
+static void _sink_end(void *ctx) {
+    (void)ctx;
+    if (_cur) _push();
+}
+
+static const SceneSink _sink = { _sink_begin, _sink_line, _sink_end, NULL };
+
+static void _core1_main(void) {
+    while (true) {
+        multicore_fifo_pop_blocking();
+        scene_render_to(&_sink);
+        __dmb();
+        _composing = false;
+    }
+}
+
+// ── Consumer: DMA on core 0 ───────────────────────────────────────────────────
+
+static void _sent(void *ctx) {
+    (void)ctx;
+    __dmb();
+    _tail = _tail + 1;
+}
+
+void render_poll(void) {
+    if (_next == _head || tft_busy()) return;
+    __dmb();                            // index before the slot contents
+    const _Slot *s = &_slots[_next++ % RENDER_SLOTS];
+    _stats.bands++;
+    _account(s->w * s->h);
+    tft_blit_async((const uint8_t *)s->px, s->x, s->y, s->w, s->h, _sent, NULL);
+}
+
+bool render_pending(void) {
+    return _next != _head && !tft_busy();
+}
+
+// ── API ───────────────────────────────────────────────────────────────────────
+
+void render_init(void) {
+    multicore_launch_core1(_core1_main);
+}
+
+bool render_begin(void) {
+    render_poll();
+    bool idle = !_composing;
+    __dmb();                            // core 1's last push before the indices
+    if (!idle || _tail != _head || tft_busy()) {
+        _stats.dropped++;
+        return false;
+    }
+    return true;
+}
+
+void render_submit(void) {
+    _stats.frames++;
+    _composing = true;
+    __dmb();                            // scene changes before the doorbell
+    multicore_fifo_push_blocking(1);
+}
+
+#else
+
+void render_init(void) { }
+
+bool render_begin(void) { return true; }
+
+void render_submit(void) {
+    _stats.frames++;
+    _account((uint32_t)scene_render());
+}
+
+void render_poll(void) { }
+
+bool render_pending(void) { return false; }
+
+#endif
+
+void render_stats(RenderStats *out) {
+    out->frames  = _stats.frames;
+    out->dropped = _stats.dropped;
+    out->stalls  = _stats.stalls;
+    out->bands   = _stats.bands;
+    out->pixels  = _stats.pixels;
+    out->bus_us  = _stats.bus_us;
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include "scene.h"
+
+// ── Render pipeline ──────────────────────────────────────────────────────────
+// Core 1 composes the scene's dirty bands into a ring of RENDER_SLOTS band
+// buffers; core 0 sends them to the display by DMA from render_poll(),
+// between USB polls, so composing never holds up the USB/SD path and the
+// card never waits more than one band for the bus.  The ring is lock-free
+// single-producer single-consumer: core 1 only advances its head, the DMA
+// completion IRQ on core 0 only advances its tail.
+//
+// Per frame, core 0 calls render_begin(), changes the scene, then
+// render_submit(), and keeps calling render_poll() until the next frame.
+// The scene (and anything its layers point at) must not change between
+// render_submit() and the next render_begin() that returns true.  When
+// render_begin() finds the last frame still being composed or sent, the
+// new frame is dropped and counted rather than waited for.
+//
+// RENDER_CORE1=0 (CMake -DTAMAGOTCHI_RENDER_CORE1=OFF) composes and sends
+// inline in render_submit() instead.
+#ifndef RENDER_CORE1
+#define RENDER_CORE1 1
+#endif
+
+#define RENDER_SLOTS        4
+#define RENDER_SLOT_PIXELS  (SCENE_BAND_LINES * TFT_W)
+
+typedef struct {
+    uint32_t frames;    // submitted
+    uint32_t dropped;   // turned away by render_begin()
+    uint32_t stalls;    // times core 1 found every slot waiting to be sent
+    uint32_t bands;     // slots sent
+    uint32_t pixels;    // pixels sent (wraps)
+    uint32_t bus_us;    // time those pixels held the bus (wraps)
+} RenderStats;
+
+// Start core 1.  After tft_init() and scene setup.
+void render_init(void);
+
+// True when the last frame is composed and sent and the scene may change;
+// false counts this frame as dropped.
+bool render_begin(void);
+
+// Compose whatever the scene has marked dirty
+void render_submit(void);
+
+// Send composed bands; call often from core 0
+void render_poll(void);
+
+// A composed band is waiting and the bus is free: render_poll() has work
+bool render_pending(void);
+
+void render_stats(RenderStats *out);
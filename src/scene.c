@@ -0,0 +1,298 @@
+#include "scene.h"
+#include "blit.h"
+#include <string.h>
+
+// ── State ─────────────────────────────────────────────────────────────────────
+
+static Layer  _layers[SCENE_MAX_LAYERS];
+static Layer *_order[SCENE_MAX_LAYERS];     // back to front
+static int    _count;
+
+static int    _scroll_top, _scroll_h;
+
+// Dirty columns [x0, x1] per band; x1 < x0 when the band is clean
+static int16_t _dirty_x0[SCENE_BANDS];
+static int16_t _dirty_x1[SCENE_BANDS];
+
+// ── Dirty bands ───────────────────────────────────────────────────────────────
+
+static void _mark(int x, int y, int w, int h) {
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > TFT_W) w = TFT_W - x;
+    if (y + h > TFT_H) h = TFT_H - y;
+    if (w <= 0 || h <= 0) return;
+
+    for (int b = y / SCENE_BAND_LINES; b <= (y + h - 1) / SCENE_BAND_LINES; b++) {
+        if (_dirty_x1[b] < _dirty_x0[b]) {
+            _dirty_x0[b] = x;
+            _dirty_x1[b] = x + w - 1;
+        } else {
+            if (x < _dirty_x0[b])         _dirty_x0[b] = x;
+            if (x + w - 1 > _dirty_x1[b]) _dirty_x1[b] = x + w - 1;
+        }
+    }
+}
+
+// Mark everything the layer currently covers on screen
+static void _mark_layer(const Layer *l) {
+    if (!l->visible) return;
+    switch (l->kind) {
+        case LAYER_FILL:   _mark(l->x, l->y, l->w, l->h);                       break;
+        case LAYER_TILE:   _mark(0, 0, TFT_W, TFT_H);                           break;
+        case LAYER_SPRITE: _mark(l->x, l->y, l->dw, l->dh);                     break;
+    }
+}
+
+void scene_invalidate(void) {
+    for (int b = 0; b < SCENE_BANDS; b++) {
+        _dirty_x0[b] = 0;
+        _dirty_x1[b] = TFT_W - 1;
+    }
+}
+
+// ── Layers ────────────────────────────────────────────────────────────────────
+
+void scene_init(void) {
+    _count = 0;
+    scene_invalidate();
+}
+
+Layer *scene_add(const Layer *l) {
+    if (_count >= SCENE_MAX_LAYERS) return NULL;
+    Layer *slot = &_layers[_count];
+    *slot = *l;
+    if (slot->dw < 1) slot->dw = slot->w;
+    if (slot->dh < 1) slot->dh = slot->h;
+
+    int i = _count++;
+    while (i > 0 && _order[i - 1]->z > slot->z) {
+        _order[i] = _order[i - 1];
+        i--;
+    }
+    _order[i] = slot;
+    _mark_layer(slot);
+    return slot;
+}
+
+void scene_move(Layer *l, int x, int y) {
+    if (l->x == x && l->y == y) return;
+    _mark_layer(l);
+    l->x = x;
+    l->y = y;
+    _mark_layer(l);
+}
+
+void scene_show(Layer *l, bool visible) {
+    if (l->visible == visible) return;
+    _mark_layer(l);
+    l->visible = visible;
+    _mark_layer(l);
+}
+
+void scene_set_sprite(Layer *l, const uint8_t *data, int bpp,
+                      const uint16_t *pal_be, int w, int h) {
+    _mark_layer(l);
+    l->data   = data;
+    l->bpp    = bpp;
+    l->pal_be = pal_be;
+    l->w      = w;
+    l->h      = h;
+    if (l->dw < 1) l->dw = w;
+    if (l->dh < 1) l->dh = h;
+    _mark_layer(l);
+}
+
+void scene_set_colour(Layer *l, uint16_t colour_be) {
+    if (l->colour_be == colour_be) return;
+    l->colour_be = colour_be;
+    _mark_layer(l);
+}
+
+void scene_fit(Layer *l, tft_fit_mode mode) {
+    scene_fit_box(l, l->w, l->h, 0, 0, mode);
+}
+
+void scene_fit_box(Layer *l, int fw, int fh, int bx, int by, tft_fit_mode mode) {
+    if (l->w <= 0 || l->h <= 0 || fw <= 0 || fh <= 0) return;
+    int x, y, dw, dh;
+    tft_fit(fw, fh, mode, &x, &y, &dw, &dh);
+    // Box edges land where the full frame's scaling puts them
+    int x0 = bx * dw / fw, x1 = (bx + l->w) * dw / fw;
+    int y0 = by * dh / fh, y1 = (by + l->h) * dh / fh;
+    if (x1 <= x0) x1 = x0 + 1;
+    if (y1 <= y0) y1 = y0 + 1;
+    if (l->x == x + x0 && l->y == y + y0 && l->dw == x1 - x0 && l->dh == y1 - y0) return;
+    _mark_layer(l);
+    l->x  = x + x0;
+    l->y  = y + y0;
+    l->dw = x1 - x0;
+    l->dh = y1 - y0;
+    _mark_layer(l);
+}
+
+void scene_touch(Layer *l) {
+    _mark_layer(l);
+}
+
+void scene_touch_rect(Layer *l, int sx, int sy, int sw, int sh) {
+    if (!l->visible || sw <= 0 || sh <= 0) return;
+    if (l->kind != LAYER_SPRITE) {
+        _mark_layer(l);
+        return;
+    }
+    const uint8_t *xmap = blit_map(l->w, l->dw);
+    const uint8_t *ymap = blit_map(l->h, l->dh);
+    if (!xmap || !ymap) {
+        _mark_layer(l);
+        return;
+    }
+    int x0, x1, y0, y1;
+    blit_map_span(xmap, l->dw, sx, sx + sw - 1, &x0, &x1);
+    blit_map_span(ymap, l->dh, sy, sy + sh - 1, &y0, &y1);
+    _mark(l->x + x0, l->y + y0, x1 - x0 + 1, y1 - y0 + 1);
+}
+
+// ── Scrolling ─────────────────────────────────────────────────────────────────
+
+// Whether any of l's rows fall in screen rows [top, top+h)
+static bool _in_rows(const Layer *l, int top, int h) {
+    switch (l->kind) {
+        case LAYER_FILL:   return l->y < top + h && l->y + l->h  > top;
+        case LAYER_TILE:   return true;
+        case LAYER_SPRITE: return l->y < top + h && l->y + l->dh > top;
+    }
+    return false;
+}
+
+void scene_scroll_area(int top, int h) {
+    tft_scroll_area(top, h);
+    _scroll_top = top;
+    _scroll_h   = (h > 0 && top >= 0 && top + h <= TFT_H) ? h : 0;
+    scene_invalidate();
+}
+
+void scene_scroll(int dy) {
+    if (_scroll_h == 0 || dy == 0) return;
+    int top = _scroll_top, h = _scroll_h;
+
+    // Layers that stay put were carried along by the hardware: repaint
+    // where they were dragged to as well as where they belong.  Those wholly
+    // outside the region were not touched
+    for (int i = 0; i < _count; i++) {
+        Layer *l = _order[i];
+        if (l->scrolls) {
+            l->y -= dy;
+        } else if (l->visible && _in_rows(l, top, h)) {
+            _mark_layer(l);
+            l->y -= dy;
+            _mark_layer(l);
+            l->y += dy;
+        }
+    }
+
+    if (dy >= h || -dy >= h) {
+        _mark(0, top, TFT_W, h);
+    } else {
+        // Rows still waiting to be drawn moved with everything else
+        for (int b = 0; b < SCENE_BANDS; b++) {
+            int y = b * SCENE_BAND_LINES;
+            if (_dirty_x1[b] < _dirty_x0[b] || y + SCENE_BAND_LINES <= top || y >= top + h)
+                continue;
+            _mark(_dirty_x0[b], y - dy, _dirty_x1[b] - _dirty_x0[b] + 1, SCENE_BAND_LINES);
+        }
+        // Rows that wrapped round to the far edge
+        if (dy > 0) _mark(0, top + h - dy, TFT_W, dy);
+        else        _mark(0, top, TFT_W, -dy);
+    }
+    tft_scroll(dy);
+}
+
+// ── Rendering ─────────────────────────────────────────────────────────────────
+
+// Draw layer l's part of screen line y, columns [x0, x0+w), into dst
+static void _draw_layer(const Layer *l, uint16_t *dst, int y, int x0, int w) {
+    switch (l->kind) {
+    case LAYER_FILL: {
+        if (y < l->y || y >= l->y + l->h) return;
+        int xa = l->x > x0 ? l->x : x0;
+        int xb = l->x + l->w < x0 + w ? l->x + l->w : x0 + w;
+        for (int x = xa; x < xb; x++) dst[x - x0] = l->colour_be;
+        return;
+    }
+    case LAYER_TILE: {
+        int ty = (y - l->y) % l->h;
+        if (ty < 0) ty += l->h;
+        const uint8_t *row = l->data + ty * l->w * 2;
+        int tx = (x0 - l->x) % l->w;
+        if (tx < 0) tx += l->w;
+        for (int x = 0; x < w; x++) {
+            memcpy(&dst[x], row + tx * 2, 2);
+            if (++tx == l->w) tx = 0;
+        }
+        return;
+    }
+    case LAYER_SPRITE: {
+        int sy = y - l->y;
+        if (sy < 0 || sy >= l->dh) return;
+        const uint8_t *ymap = blit_map(l->h, l->dh);
+        if (!ymap) return;
+        const uint8_t *row = l->data + ymap[sy] * ((l->w * l->bpp + 7) / 8);
+        int xa = l->x > x0 ? l->x : x0;
+        int xb = l->x + l->dw;
+        if (xb > x0 + w) xb = x0 + w;
+        if (xb > xa)
+            blit_sprite_row(row, l->bpp, l->w, l->dw, xa - l->x, xb - xa,
+                            l->pal_be, dst + (xa - x0));
+        return;
+    }
+    }
+}
+
+static void      _tft_begin(void *ctx, int x, int y, int w, int h) { (void)ctx; tft_stream_begin(x, y, w, h); }
+static uint16_t *_tft_line(void *ctx)                              { (void)ctx; return tft_stream_line(); }
+static void      _tft_end(void *ctx)                               { (void)ctx; tft_stream_end(); }
+
+static const SceneSink _tft_sink = { _tft_begin, _tft_line, _tft_end, NULL };
+
+int scene_render(void) {
+    return scene_render_to(&_tft_sink);
+}
+
+int scene_render_to(const SceneSink *sink) {
+    int sent = 0;
+    int b = 0;
+    while (b < SCENE_BANDS) {
+        if (_dirty_x1[b] < _dirty_x0[b]) { b++; continue; }
+
+        // Run of consecutive dirty bands → one window over their column union
+        int x0 = _dirty_x0[b], x1 = _dirty_x1[b];
+        int b1 = b;
+        while (b1 + 1 < SCENE_BANDS && _dirty_x1[b1 + 1] >= _dirty_x0[b1 + 1]) {
+            b1++;
+            if (_dirty_x0[b1] < x0) x0 = _dirty_x0[b1];
+            if (_dirty_x1[b1] > x1) x1 = _dirty_x1[b1];
+        }
+        int y0 = b * SCENE_BAND_LINES;
+        int y1 = (b1 + 1) * SCENE_BAND_LINES;
+        if (y1 > TFT_H) y1 = TFT_H;
+        int w  = x1 - x0 + 1;
+
+        sink->begin(sink->ctx, x0, y0, w, y1 - y0);
+        for (int y = y0; y < y1; y++) {
+            uint16_t *line = sink->line(sink->ctx);
+            memset(line, 0, w * 2);
+            for (int i = 0; i < _count; i++)
+                if (_order[i]->visible) _draw_layer(_order[i], line, y, x0, w);
+        }
+        sink->end(sink->ctx);
+        sent += w * (y1 - y0);
+
+        for (int k = b; k <= b1; k++) {
+            _dirty_x0[k] = 0;
+            _dirty_x1[k] = -1;
+        }
+        b = b1 + 1;
+    }
+    return sent;
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include "st7735.h"
+
+// ── Scanline compositor ──────────────────────────────────────────────────────
+// A handful of layers (background, character, props, HUD) drawn back to
+// front one screen line at a time into the display's band buffers — there
+// is no framebuffer.  The screen is split into bands of SCENE_BAND_LINES
+// lines; moving or changing a layer marks the bands (and the columns within
+// them) it covers, and scene_render() redraws only those.
+
+#define SCENE_MAX_LAYERS   8
+#define SCENE_BAND_LINES   8
+#define SCENE_BANDS        ((TFT_H + SCENE_BAND_LINES - 1) / SCENE_BAND_LINES)
+
+typedef enum {
+    LAYER_FILL,     // solid colour over (x, y, w, h) screen pixels
+    LAYER_TILE,     // RGB565 big-endian w×h tile repeated over the whole
+                    // screen, with (x, y) as the tile origin
+    LAYER_SPRITE,   // packed palette indices (1, 4 or 8 bpp, rows padded to a
+                    // byte, index 0 transparent), w×h stretched to dw×dh
+} LayerKind;
+
+typedef struct {
+    LayerKind       kind;
+    bool            visible;
+    bool            scrolls;    // moves with scene_scroll()
+    int             z;          // drawn in increasing z
+    int             x, y;       // screen position of the top-left corner
+    int             w, h;       // source size (screen size for LAYER_FILL)
+    int             dw, dh;     // LAYER_SPRITE screen size, 0 = w, h
+    uint16_t        colour_be;  // LAYER_FILL
+    const uint8_t  *data;       // LAYER_TILE / LAYER_SPRITE
+    int             bpp;        // LAYER_SPRITE
+    const uint16_t *pal_be;     // LAYER_SPRITE
+} Layer;
+
+// Drop all layers and mark the whole screen dirty
+void   scene_init(void);
+
+// Add a copy of l, returning the handle to change it through.  NULL when the
+// scene is full.  Layers are kept in z order; equal z keeps insertion order.
+Layer *scene_add(const Layer *l);
+
+// Change a layer and mark what it covered before and after as dirty.  Layer
+// fields must not be written directly once added.  A new sprite is stretched
+// over the layer's current dw×dh.
+void   scene_move(Layer *l, int x, int y);
+void   scene_show(Layer *l, bool visible);
+void   scene_set_sprite(Layer *l, const uint8_t *data, int bpp,
+                        const uint16_t *pal_be, int w, int h);
+void   scene_set_colour(Layer *l, uint16_t colour_be);
+
+// Size the sprite to fill the screen under mode, centred
+void   scene_fit(Layer *l, tft_fit_mode mode);
+
+// The same for a sprite that is only the (bx, by) box of a larger fw×fh
+// frame: the frame is fitted and the layer covers just the box's part of
+// it.  Whatever the old box covered and the new one does not is redrawn
+// once from the layers beneath.
+void   scene_fit_box(Layer *l, int fw, int fh, int bx, int by, tft_fit_mode mode);
+
+// The layer's pixels changed in place: all of them, or only the source
+// rectangle (sx, sy, sw, sh)
+void   scene_touch(Layer *l);
+void   scene_touch_rect(Layer *l, int sx, int sy, int sw, int sh);
+
+// ── Scrolling ────────────────────────────────────────────────────────────────
+// Screen rows [top, top+h) scroll in hardware.  scene_scroll(dy) moves every
+// layer with `scrolls` set up by dy rows (down if negative) at the cost of
+// the dy exposed rows, plus whatever non-scrolling layers in the region
+// cover before and after — keep those small.  Scrolling layers should lie
+// inside the region.
+void   scene_scroll_area(int top, int h);
+void   scene_scroll(int dy);
+
+// Mark the whole screen dirty, e.g. after something else drew on it
+void   scene_invalidate(void);
+
+// Redraw every dirty band.  Returns the number of pixels sent.
+int    scene_render(void);
+
+// ── Output ───────────────────────────────────────────────────────────────────
+// Where scene_render_to() puts the dirty bands instead of the display: for
+// each run of dirty bands begin() opens the window, line() is called once
+// per row for a w-pixel buffer (RGB565 big-endian) to compose it into, and
+// end() closes it.  scene_render() uses the display's line streaming.
+typedef struct {
+    void      (*begin)(void *ctx, int x, int y, int w, int h);
+    uint16_t *(*line)(void *ctx);
+    void      (*end)(void *ctx);
+    void       *ctx;
+} SceneSink;
+
+int    scene_render_to(const SceneSink *sink);
@@ -0,0 +1,153 @@
+#include "sched.h"
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+#include <stdio.h>
+#include <string.h>
+
+// ── State ─────────────────────────────────────────────────────────────────────
+
+enum { TASK_DUE, TASK_SLEEPING, TASK_WAITING };
+
+static Task    *_tasks[SCHED_MAX_TASKS];    // by prio
+static int      _count;
+static uint32_t _wakeups;
+
+void sched_add(Task *t) {
+    if (_count >= SCHED_MAX_TASKS) return;
+    t->lc    = 0;
+    t->state = TASK_DUE;
+    t->due   = true;
+    t->due_us = time_us_32();
+    int i = _count++;
+    while (i > 0 && _tasks[i - 1]->prio > t->prio) {
+        _tasks[i] = _tasks[i - 1];
+        i--;
+    }
+    _tasks[i] = t;
+}
+
+void sched_sleep(Task *t, uint32_t us) {
+    t->state   = TASK_SLEEPING;
+    t->wake_us = time_us_32() + us;
+}
+
+void sched_wait(Task *t) {
+    t->state = TASK_WAITING;
+}
+
+uint32_t sched_wakeups(void) {
+    return _wakeups;
+}
+
+// ── Statistics ────────────────────────────────────────────────────────────────
+
+static int _bucket(uint32_t us) {
+    int b = 0;
+    while (us >= 2 && b < SCHED_HIST - 1) { us >>= 1; b++; }
+    return b;
+}
+
+static void _record(TaskStats *s, uint32_t run, uint32_t lat) {
+    s->runs++;
+    s->run_us += run;
+    s->lat_us += lat;
+    if (run > s->run_max_us) s->run_max_us = run;
+    if (lat > s->lat_max_us) s->lat_max_us = lat;
+    s->run_hist[_bucket(run)]++;
+    s->lat_hist[_bucket(lat)]++;
+}
+
+static void _print_hist(const char *what, const uint32_t *h) {
+    int top = SCHED_HIST - 1;
+    while (top > 0 && !h[top]) top--;
+    printf("    %s:", what);
+    for (int b = 0; b <= top; b++) printf(" %lu", (unsigned long)h[b]);
+    printf("\n");
+}
+
+void sched_report(void) {
+    printf("tasks (log2 us buckets from <2):\n");
+    for (int i = 0; i < _count; i++) {
+        Task *t = _tasks[i];
+        TaskStats *s = &t->stats;
+        uint32_t n = s->runs ? s->runs : 1;
+        printf("  %-6s p%d: %lu runs, run avg %lu max %lu us, latency avg %lu max %lu us\n",
+               t->name, t->prio, (unsigned long)s->runs,
+               (unsigned long)(s->run_us / n), (unsigned long)s->run_max_us,
+               (unsigned long)(s->lat_us / n), (unsigned long)s->lat_max_us);
+        if (s->runs) {
+            _print_hist("run", s->run_hist);
+            _print_hist("lat", s->lat_hist);
+        }
+        memset(s, 0, sizeof *s);
+    }
+}
+
+// ── Dispatch ──────────────────────────────────────────────────────────────────
+
+static bool _is_due(Task *t, uint32_t now) {
+    if (t->due) return true;
+    if (t->state == TASK_SLEEPING && (int32_t)(now - t->wake_us) >= 0) {
+        t->due_us = t->wake_us;
+    } else if (t->ready && t->ready()) {
+        t->due_us = now;
+    } else {
+        return false;
+    }
+    t->due = true;
+    return true;
+}
+
+static void _run(Task *t) {
+    uint32_t start = time_us_32();
+    t->due   = false;
+    t->state = TASK_DUE;        // unless it sleeps or waits
+    t->fn(t);
+    uint32_t end = time_us_32();
+    _record(&t->stats, end - start, start - t->due_us);
+    if (t->state == TASK_DUE) {
+        t->due    = true;
+        t->due_us = end;
+    }
+}
+
+static int64_t _wake_alarm(alarm_id_t id, void *ctx) {
+    (void)id; (void)ctx;
+    __sev();
+    return 0;
+}
+
+// Nothing is due: sleep until the earliest wake time or an event
+static void _idle(uint32_t now) {
+    if (SCHED_IDLE_POLL_US) {
+        sleep_us(SCHED_IDLE_POLL_US);
+        _wakeups++;
+        return;
+    }
+    uint32_t wait = 0;
+    bool timed = false;
+    for (int i = 0; i < _count; i++) {
+        Task *t = _tasks[i];
+        if (t->state != TASK_SLEEPING) continue;
+        uint32_t w = t->wake_us - now;
+        if (!timed || w < wait) wait = w;
+        timed = true;
+    }
+    alarm_id_t alarm = timed ? add_alarm_in_us(wait, _wake_alarm, NULL, true) : 0;
+    __wfe();
+    _wakeups++;
+    if (alarm > 0) cancel_alarm(alarm);
+}
+
+void sched_run(void) {
+    while (true) {
+        // Every task is checked so latency counts from when it became due,
+        // not from when the tasks ahead of it let the scan reach it
+        uint32_t now = time_us_32();
+        Task *next = NULL;
+        for (int i = 0; i < _count; i++)
+            if (_is_due(_tasks[i], now) && !next) next = _tasks[i];
+        if (next) _run(next);
+        else      _idle(now);
+    }
+}
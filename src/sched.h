@@ -0,0 +1,79 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+// ── Cooperative scheduler ────────────────────────────────────────────────────
+// Protothread-style tasks on core 0.  A task is a function that is entered
+// again at the point it last yielded, through a switch on the line number it
+// left from, so locals do not survive a yield: keep task state in statics.
+// Nothing preempts a task, so every step between two yields must be short —
+// long jobs are split into steps that yield in between.
+//
+// sched_run() always runs the due task with the lowest prio number.  A task
+// is due when it yielded, when its sleep ran out, or when its ready()
+// predicate (checked on every pass, so keep it cheap) returns true.  With
+// nothing due the core sleeps in __wfe() until the earliest wake time or
+// the next event; SCHED_IDLE_POLL_US > 0 polls at that interval instead.
+//
+// Per task, each step's run time and its latency — from becoming due to
+// running — are kept as log2 histograms: bucket b counts [2^b, 2^(b+1)) us,
+// the first also 0 and the last everything above.
+
+#define SCHED_MAX_TASKS  4
+#define SCHED_HIST       16
+
+#ifndef SCHED_IDLE_POLL_US
+#define SCHED_IDLE_POLL_US 0
+#endif
+
+typedef struct Task Task;
+
+typedef struct {
+    uint32_t runs;
+    uint32_t run_us, run_max_us;    // total (wraps) and worst step
+    uint32_t lat_us, lat_max_us;
+    uint32_t run_hist[SCHED_HIST];
+    uint32_t lat_hist[SCHED_HIST];
+} TaskStats;
+
+struct Task {
+    const char *name;
+    uint8_t     prio;               // 0 runs first
+    void      (*fn)(Task *t);
+    bool      (*ready)(void);       // NULL: wakes by time only
+    // Scheduler state
+    uint16_t    lc;                 // line to resume at, 0 = the top
+    uint8_t     state;
+    bool        due;
+    uint32_t    due_us;             // when it became due
+    uint32_t    wake_us;
+    TaskStats   stats;
+};
+
+// ── Task body ────────────────────────────────────────────────────────────────
+//   TASK_BEGIN(t); ... TASK_END(t);   around the whole function body
+//   TASK_YIELD(t)       let anything more urgent run, then carry on
+//   TASK_SLEEP(t, us)   carry on after us, or sooner once ready()
+//   TASK_WAIT(t)        carry on once ready()
+// Each may appear at most once per source line, and not inside a switch.
+
+#define TASK_BEGIN(t)       switch ((t)->lc) { case 0:
+#define TASK_END(t)         } (t)->lc = 0
+#define TASK_YIELD(t)       do { (t)->lc = __LINE__; return; case __LINE__:; } while (0)
+#define TASK_SLEEP(t, us)   do { sched_sleep((t), (us)); TASK_YIELD(t); } while (0)
+#define TASK_WAIT(t)        do { sched_wait(t); TASK_YIELD(t); } while (0)
+
+void sched_sleep(Task *t, uint32_t us);
+void sched_wait(Task *t);
+
+// Register t (kept in prio order; equal prio keeps insertion order)
+void sched_add(Task *t);
+
+// Run the tasks for ever
+void sched_run(void) __attribute__((noreturn));
+
+// Times the core woke from idle
+uint32_t sched_wakeups(void);
+
+// Print each task's statistics since the last report and reset them
+void sched_report(void);
@@ -28,6 +28,7 @@ mutex_t sd_mutex;
 
 static uint32_t _sector_count = 0;
 static bool     _hc = false;   // true = SDHC/SDXC (block addressed)
+static uint32_t _full_hz;      // SD_FULL_BAUD as the divider got it
 
 static inline void _sd_cs_lo(void) { gpio_put(SD_PIN_CS, 0); }
 static inline void _sd_cs_hi(void) { gpio_put(SD_PIN_CS, 1); }
@@ -42,6 +43,13 @@ static void _spi_skip(int n) {
     while (n--) _spi_byte(0xFF);
 }
 
+// The display runs spi0 faster than the card takes: wait for it to finish
+// and put the card's baud back
+static void _take_bus(void) {
+    tft_release_bus();
+    if (spi_get_baudrate(TFT_SPI) != _full_hz) spi_set_baudrate(TFT_SPI, SD_FULL_BAUD);
+}
+
 static uint8_t _cmd(uint8_t cmd, uint32_t arg) {
     _spi_byte(0xFF);
     _spi_byte(0x40 | cmd);
@@ -64,6 +72,8 @@ static uint8_t _cmd(uint8_t cmd, uint32_t arg) {
 }
 
 bool sd_init(void) {
+    tft_release_bus();   // display DMA or PIO may still own the pins
+
     // SD CS pin — already initialised by tft_init(), just ensure it's high
     gpio_put(SD_PIN_CS, 1);
 
@@ -106,7 +116,7 @@ bool sd_init(void) {
     _spi_skip(1);
 
     // Ramp up SPI speed
-    spi_set_baudrate(TFT_SPI, SD_FULL_BAUD);
+    _full_hz = spi_set_baudrate(TFT_SPI, SD_FULL_BAUD);
 
     // CMD9 — read CSD register to get actual sector count
     _sd_cs_lo();
@@ -152,6 +162,7 @@ bool sd_init(void) {
 
 bool sd_read_blocks(uint32_t lba, uint8_t *buf, uint32_t count) {
     mutex_enter_blocking(&sd_mutex);
+    _take_bus();
     if (!_hc) lba <<= 9;
     bool ok = true;
     for (uint32_t i = 0; i < count; i++) {
@@ -177,6 +188,7 @@ bool sd_read_blocks(uint32_t lba, uint8_t *buf, uint32_t count) {
 
 bool sd_write_blocks(uint32_t lba, const uint8_t *buf, uint32_t count) {
     mutex_enter_blocking(&sd_mutex);
+    _take_bus();
     if (!_hc) lba <<= 9;
     bool ok = true;
     for (uint32_t i = 0; i < count; i++) {
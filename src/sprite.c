@@ -0,0 +1,193 @@
+#include "sprite.h"
+#include <string.h>
+
+// ── Decoding helpers ──────────────────────────────────────────────────────────
+
+static inline uint8_t _index_at(const uint8_t *src, int bpp, int i) {
+    if (bpp == 8) return src[i];
+    return (i & 1) ? (src[i >> 1] & 0x0F) : (src[i >> 1] >> 4);
+}
+
+static void _rect_add(SpriteRect *r, int x, int y, int w) {
+    if (r->w == 0) {
+        r->x = x; r->y = y; r->w = w; r->h = 1;
+        return;
+    }
+    int x1 = r->x + r->w, y1 = r->y + r->h;
+    if (x < r->x)     r->x = x;
+    if (y < r->y)     r->y = y;
+    if (x + w > x1)   x1 = x + w;
+    if (y + 1 > y1)   y1 = y + 1;
+    r->w = x1 - r->x;
+    r->h = y1 - r->y;
+}
+
+// ── LZ stream ─────────────────────────────────────────────────────────────────
+
+void sprite_lz_init(SpriteLz *d, const uint8_t *src, uint32_t len) {
+    d->src   = src;
+    d->end   = src + len;
+    d->pos   = 0;
+    d->dist  = 0;
+    d->lit   = 0;
+    d->match = 0;
+    d->mcode = -1;
+}
+
+// Read a length nibble's continuation bytes
+static uint16_t _lz_ext(SpriteLz *d, uint16_t n) {
+    if (n != 15) return n;
+    while (d->src < d->end) {
+        uint8_t b = *d->src++;
+        n += b;
+        if (b != 255) break;
+    }
+    return n;
+}
+
+// Load the next literal run or match; false at the end of the data
+static bool _lz_refill(SpriteLz *d) {
+    if (d->mcode >= 0) {
+        uint16_t m = (uint16_t)d->mcode;
+        d->mcode = -1;
+        if (d->src >= d->end) return false;   // literal-only final sequence
+        d->dist  = *d->src++;
+        d->match = _lz_ext(d, m) + 3;
+        return d->dist != 0;
+    }
+    if (d->src >= d->end) return false;
+    uint8_t token = *d->src++;
+    d->lit   = _lz_ext(d, token >> 4);
+    d->mcode = token & 0x0F;
+    return true;
+}
+
+int sprite_lz_read(SpriteLz *d, uint8_t *out, int n) {
+    int done = 0;
+    while (done < n) {
+        uint8_t b;
+        if (d->lit) {
+            if (d->src >= d->end) break;      // truncated
+            b = *d->src++;
+            d->lit--;
+        } else if (d->match) {
+            b = d->window[(uint8_t)(d->pos - d->dist)];
+            d->match--;
+        } else {
+            if (!_lz_refill(d)) break;
+            continue;
+        }
+        d->window[d->pos++] = b;
+        out[done++] = b;
+    }
+    return done;
+}
+
+// ── Key-frame rows ────────────────────────────────────────────────────────────
+
+void sprite_rows_begin(SpriteRows *r, const SpriteEntry *e) {
+    r->e      = e;
+    r->stride = (e->w * e->bpp + 7) / 8;
+    if (e->kind == SPRITE_KEY_LZ)
+        sprite_lz_init(&r->lz, e->data, e->len);
+}
+
+const uint8_t *sprite_rows_next(SpriteRows *r, int y) {
+    if (r->e->kind != SPRITE_KEY_LZ)
+        return r->e->data + y * r->stride;
+    int n = sprite_lz_read(&r->lz, r->row, r->stride);
+    if (n < r->stride) memset(r->row + n, 0, r->stride - n);
+    return r->row;
+}
+
+static void _decode_key(SpritePlayer *p, const SpriteEntry *e) {
+    static SpriteRows rows;
+    sprite_rows_begin(&rows, e);
+    for (int row = 0; row < e->h; row++) {
+        const uint8_t *src = sprite_rows_next(&rows, row);
+        uint8_t       *dst = p->canvas + row * e->w;
+        for (int col = 0; col < e->w; col++)
+            dst[col] = _index_at(src, e->bpp, col);
+    }
+}
+
+// Apply one delta in place, growing *changed by every pixel that differs
+static void _apply_delta(SpritePlayer *p, const SpriteEntry *e, SpriteRect *changed) {
+    const uint8_t *src = e->data;
+    const uint8_t *end = e->data + e->len;
+    int pos = 0;
+    int max = p->w * p->h;
+    while (src + 2 <= end) {
+        pos += src[0];
+        int count = src[1];
+        src += 2;
+        int bytes = (count * e->bpp + 7) / 8;
+        if (src + bytes > end || pos + count > max) break;   // malformed
+        if (count > 0) {
+            uint8_t *dst = p->canvas + pos;
+            for (int i = 0; i < count; i++)
+                dst[i] = _index_at(src, e->bpp, i);
+            _rect_add(changed, pos % p->w, pos / p->w, count);
+            pos += count;
+        }
+        src += bytes;
+    }
+}
+
+// ── Player ────────────────────────────────────────────────────────────────────
+
+void sprite_player_clear(SpritePlayer *p) {
+    p->count   = 0;
+    p->current = -1;
+    p->wrap    = NULL;
+    p->palette = NULL;
+    p->w = p->h = p->x = p->y = p->fw = p->fh = 0;
+}
+
+bool sprite_player_add(SpritePlayer *p, const SpriteEntry *e) {
+    if (SPRITE_IS_KEY(e->kind)) {
+        if (p->count > 0) return false;   // one sequence per player
+        if (e->w > SPRITE_MAX_W || e->w * e->h > SPRITE_MAX_PIXELS) return false;
+        p->w       = e->w;
+        p->h       = e->h;
+        p->x       = e->x;
+        p->y       = e->y;
+        p->fw      = e->fw;
+        p->fh      = e->fh;
+        p->palette = e->palette;
+    } else if (p->count == 0 || e->w != p->w || e->h != p->h ||
+               e->x != p->x || e->y != p->y) {
+        return false;
+    }
+
+    if (e->kind == SPRITE_WRAP) {
+        p->wrap = e;
+        return true;
+    }
+    if (p->count >= SPRITE_MAX_FRAMES) return false;
+    p->frames[p->count++] = e;
+    return true;
+}
+
+bool sprite_player_seek(SpritePlayer *p, int n, SpriteRect *changed) {
+    changed->x = changed->y = changed->w = changed->h = 0;
+    if (p->count == 0) return false;
+    n %= p->count;
+    if (n == p->current) return true;
+
+    if (p->current >= 0 && n == p->current + 1) {
+        _apply_delta(p, p->frames[n], changed);
+    } else if (p->current == p->count - 1 && n == 0 && p->wrap) {
+        _apply_delta(p, p->wrap, changed);
+    } else {
+        _decode_key(p, p->frames[0]);
+        for (int i = 1; i <= n; i++) {
+            SpriteRect ignored = { 0 };
+            _apply_delta(p, p->frames[i], &ignored);
+        }
+        changed->w = p->w;
+        changed->h = p->h;
+    }
+    p->current = n;
+    return true;
+}
@@ -0,0 +1,122 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+// ── Sprite storage (see tools/spritepack) ─────────────────────────────────────
+// Pixels are palette indices, rows top-down, each row padded to a whole
+// byte; at 4 bpp the left pixel is in the high nibble.  Only the w×h box
+// at (x, y) of the fw×fh frame is stored — the rest is transparent in every
+// frame of the sequence, so all entries of a sequence share the box.
+//
+// SPRITE_KEY    data is the full frame.
+// SPRITE_KEY_LZ data is the full frame, LZ-compressed (format below).
+// SPRITE_DELTA  data is the changes from the previous frame in the sequence.
+// SPRITE_WRAP   data is the changes from the last frame back to the first;
+//               applied only when the animation loops.
+//
+// Delta data is a list of spans in row-major pixel order:
+//   <skip> <count> <count indices packed at bpp, padded to a whole byte>
+// skip is the number of unchanged pixels since the end of the previous span
+// (255 with count 0 just extends the skip).  A span never crosses a row.
+//
+// LZ data is a list of LZ4-style sequences:
+//   <token> [literal length ext] <literals> [<offset> [match length ext]]
+// The token's high nibble is the literal count and its low nibble the match
+// length minus 3; a nibble of 15 is continued by bytes added on until one
+// is below 255.  offset (1..255) counts back from the end of the output, so
+// a decoder only needs the last 256 bytes.  The final sequence has literals
+// only and ends the data.
+typedef enum { SPRITE_KEY = 0, SPRITE_KEY_LZ, SPRITE_DELTA, SPRITE_WRAP } SpriteKind;
+
+#define SPRITE_IS_KEY(kind)  ((kind) == SPRITE_KEY || (kind) == SPRITE_KEY_LZ)
+
+typedef struct {
+    const uint8_t  *data;
+    uint32_t        len;
+    uint16_t        w, h;       // stored box
+    uint16_t        x, y;       // where the box sits in the full frame
+    uint16_t        fw, fh;     // full frame
+    uint8_t         bpp;        // 4 or 8
+    const uint16_t *palette;    // RGB565 big-endian, 1 << bpp entries
+    uint8_t         kind;       // SpriteKind
+    int             tier;       // Tier enum
+    int             state;      // AnimState enum
+    uint8_t         character;  // SpriteCharacter (generated sprites.h)
+} SpriteEntry;
+
+// A run of sprite_table entries forming one animation, as found through the
+// generated sprite_index; tier/state are what the run actually holds.
+typedef struct {
+    uint16_t first, count;
+    uint8_t  tier, state;
+} SpriteSeq;
+
+typedef struct { int x, y, w, h; } SpriteRect;
+
+// ── Streaming key-frame decoder ───────────────────────────────────────────────
+// Emits a key frame one packed row at a time straight from flash.  Peak RAM
+// is the 256-byte LZ window plus one row, whatever the frame size.
+
+#define SPRITE_LZ_WINDOW   256
+#define SPRITE_MAX_W       64
+
+typedef struct {
+    const uint8_t *src, *end;
+    uint8_t        window[SPRITE_LZ_WINDOW];
+    uint8_t        pos;        // next write position in window (wraps)
+    uint8_t        dist;       // offset of the match being copied
+    uint16_t       lit;        // literals left in the current sequence
+    uint16_t       match;      // match bytes left in the current sequence
+    int16_t        mcode;      // match nibble still to be read, -1 if none
+} SpriteLz;
+
+void sprite_lz_init(SpriteLz *d, const uint8_t *src, uint32_t len);
+
+// Decode up to n bytes into out.  Returns the number written, short only
+// at the end of the data.
+int  sprite_lz_read(SpriteLz *d, uint8_t *out, int n);
+
+typedef struct {
+    const SpriteEntry *e;
+    int                stride;
+    SpriteLz           lz;
+    uint8_t            row[(SPRITE_MAX_W * 8 + 7) / 8];
+} SpriteRows;
+
+// Start reading the rows of a key frame (SPRITE_KEY or SPRITE_KEY_LZ).
+void sprite_rows_begin(SpriteRows *r, const SpriteEntry *e);
+
+// Packed row y, valid until the next call.  Rows must be requested in order.
+const uint8_t *sprite_rows_next(SpriteRows *r, int y);
+
+// ── Player ────────────────────────────────────────────────────────────────────
+// Holds the current frame of one sequence as 8-bit indices and moves between
+// frames by applying deltas in place.
+
+#define SPRITE_MAX_FRAMES  16
+#define SPRITE_MAX_PIXELS  (64 * 64)
+
+typedef struct {
+    const SpriteEntry *frames[SPRITE_MAX_FRAMES];
+    const SpriteEntry *wrap;        // last → first, NULL for single frames
+    int                count;
+    int                current;     // index of the frame in canvas, -1 = none
+    int                w, h;        // canvas: the sequence's stored box
+    int                x, y;        //   at (x, y) of the fw×fh frame
+    int                fw, fh;
+    const uint16_t    *palette;
+    uint8_t            canvas[SPRITE_MAX_PIXELS];
+} SpritePlayer;
+
+// Forget the current sequence.
+void sprite_player_clear(SpritePlayer *p);
+
+// Append the next entry of a sequence, in sprite_table order.  Returns false
+// if the entry does not fit (too many frames, too large, or no key frame yet).
+bool sprite_player_add(SpritePlayer *p, const SpriteEntry *e);
+
+// Bring the canvas to frame n.  Stepping to the next frame (or looping back
+// to frame 0) applies one delta; anything else re-decodes from the key frame.
+// *changed receives the bounding box of pixels that changed (w = 0 if none).
+// Returns false if the player holds no frames.
+bool sprite_player_seek(SpritePlayer *p, int n, SpriteRect *changed);
@@ -1,1581 +0,0 @@
-#pragma once
-#include <stdint.h>
-
-// Auto-generated by convert_sprites.sh — do not edit manually.
-// Re-run ./convert_sprites.sh from the project root to regenerate.
-
-// sprites/djungelskog/LARGE_IDLE_1.bmp
-static const uint8_t sprite_djungelskog_large_idle_1[] = {
-      0x42, 0x4d, 0x96, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00,
-      0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
-      0x00, 0x00, 0x01, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x6e,
-      0x69, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0x30, 0x30, 0x30, 0xff, 0x30, 0x30, 0x30, 0xff, 0x16, 0x22,
-      0x42, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x16, 0x22,
-      0x42, 0xff, 0x46, 0x46, 0x46, 0xff, 0x46, 0x46, 0x46, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x30, 0x30, 0x30, 0xff, 0x16, 0x22,
-      0x42, 0xff, 0x16, 0x22, 0x42, 0xff, 0x16, 0x22, 0x42, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x16, 0x22,
-      0x42, 0xff, 0x16, 0x22, 0x42, 0xff, 0x16, 0x22, 0x42, 0xff, 0x46, 0x46,
-      0x46, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x16, 0x22,
-      0x42, 0xff, 0x16, 0x22, 0x42, 0xff, 0x16, 0x22, 0x42, 0xff, 0x16, 0x22,
-      0x42, 0xff, 0x16, 0x22, 0x42, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x16, 0x22,
-      0x42, 0xff, 0x16, 0x22, 0x42, 0xff, 0x16, 0x22, 0x42, 0xff, 0x16, 0x22,
-      0x42, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x16, 0x22,
-      0x42, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x16, 0x22,
-      0x42, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x16, 0x22, 0x42, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1c, 0x2e,
-      0x5c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x16, 0x22,
-      0x42, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x16, 0x22, 0x42, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1c, 0x2e,
-      0x5c, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x16, 0x22, 0x42, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1c, 0x2e,
-      0x5c, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1c, 0x2e,
-      0x5c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x16, 0x22, 0x42, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x1c, 0x2e,
-      0x5c, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1c, 0x2e,
-      0x5c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x16, 0x22,
-      0x42, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x1c, 0x2e,
-      0x5c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x16, 0x22, 0x42, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x16, 0x22, 0x42, 0xff, 0x16, 0x22, 0x42, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1c, 0x2e,
-      0x5c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x16, 0x22,
-      0x42, 0xff, 0x16, 0x22, 0x42, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0xb1, 0xa3,
-      0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1c, 0x2e,
-      0x5c, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0x16, 0x22, 0x42, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1c, 0x2e,
-      0x5c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-static const uint32_t sprite_djungelskog_large_idle_1_len = 1174;
-
-// sprites/djungelskog/MEDIUM_IDLE_1.bmp
-static const uint8_t sprite_djungelskog_medium_idle_1[] = {
-      0x42, 0x4d, 0x96, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00,
-      0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
-      0x00, 0x00, 0x01, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x6e,
-      0x69, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x16, 0x22,
-      0x42, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x46, 0x46,
-      0x46, 0xff, 0x16, 0x22, 0x42, 0xff, 0x16, 0x22, 0x42, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x1c, 0x2e,
-      0x5c, 0xff, 0x46, 0x46, 0x46, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0x16, 0x22, 0x42, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x16, 0x22, 0x42, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x16, 0x22,
-      0x42, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1c, 0x2e,
-      0x5c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x16, 0x22, 0x42, 0xff, 0x16, 0x22, 0x42, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1c, 0x2e,
-      0x5c, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x16, 0x22,
-      0x42, 0xff, 0x16, 0x22, 0x42, 0xff, 0x00, 0x00, 0x00, 0xff, 0x16, 0x22,
-      0x42, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x16, 0x22, 0x42, 0xff, 0x16, 0x22,
-      0x42, 0xff, 0x16, 0x22, 0x42, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1c, 0x2e,
-      0x5c, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x1c, 0x2e,
-      0x5c, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x16, 0x22, 0x42, 0xff, 0x16, 0x22, 0x42, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xb1, 0xa3,
-      0xff, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x16, 0x22,
-      0x42, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1c, 0x2e,
-      0x5c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x16, 0x22,
-      0x42, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-static const uint32_t sprite_djungelskog_medium_idle_1_len = 1174;
-
-// sprites/djungelskog/SMALL_IDLE_1.bmp
-static const uint8_t sprite_djungelskog_small_idle_1[] = {
-      0x42, 0x4d, 0x96, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00,
-      0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
-      0x00, 0x00, 0x01, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x6e,
-      0x69, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x16, 0x22, 0x42, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x46, 0x46, 0x46, 0xff, 0x16, 0x22,
-      0x42, 0xff, 0x16, 0x22, 0x42, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1c, 0x2e,
-      0x5c, 0xff, 0x46, 0x46, 0x46, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x16, 0x22, 0x42, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1c, 0x2e,
-      0x5c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x46, 0x46,
-      0x46, 0xff, 0x16, 0x22, 0x42, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x16, 0x22, 0x42, 0xff, 0x16, 0x22, 0x42, 0xff, 0x16, 0x22,
-      0x42, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x46, 0x46, 0x46, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x16, 0x22,
-      0x42, 0xff, 0x16, 0x22, 0x42, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1a, 0x29, 0x4d, 0xff, 0x1a, 0x29,
-      0x4d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x16, 0x22, 0x42, 0xff, 0x1c, 0x2e,
-      0x5c, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x16, 0x22, 0x42, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x1c, 0x2e, 0x5c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-static const uint32_t sprite_djungelskog_small_idle_1_len = 1174;
-
-// sprites/hangyodon/LARGE_IDLE_1.bmp
-static const uint8_t sprite_hangyodon_large_idle_1[] = {
-      0x42, 0x4d, 0x96, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00,
-      0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
-      0x00, 0x00, 0x01, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x6e,
-      0x69, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0x5c, 0x4f, 0x27, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x5c, 0x4f,
-      0x27, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xad, 0x85,
-      0x03, 0xff, 0xad, 0x85, 0x03, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xcc, 0x9c,
-      0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xcc, 0x9c,
-      0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xcc, 0x9c,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xad, 0x85,
-      0x03, 0xff, 0xad, 0x85, 0x03, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xc2, 0xa1, 0x36, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0xad, 0x85, 0x03, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xc2, 0xa1, 0x36, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xc2, 0xa1, 0x36, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xff, 0xd8,
-      0x57, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xad, 0x85, 0x03, 0xff, 0xcc, 0x9c,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xc2, 0xa1, 0x36, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xff, 0xd8,
-      0x57, 0xff, 0xff, 0xd8, 0x57, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xad, 0x85, 0x03, 0xff, 0xad, 0x85,
-      0x03, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xa3, 0x88, 0x2f, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xc2, 0xa1, 0x36, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xff, 0xd8,
-      0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x57, 0xff, 0xff, 0xd8,
-      0x57, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xad, 0x85, 0x03, 0xff, 0xcc, 0x9c,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xff, 0xd8, 0x57, 0xff, 0xff, 0xd8,
-      0x57, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xff, 0xd8, 0x57, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb1, 0xa3,
-      0xff, 0xff, 0x7b, 0x71, 0xad, 0xff, 0x7b, 0x71, 0xad, 0xff, 0xb1, 0xa3,
-      0xff, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0xb1, 0xa3,
-      0xff, 0xff, 0x7b, 0x71, 0xad, 0xff, 0x7b, 0x71, 0xad, 0xff, 0xb1, 0xa3,
-      0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x99, 0x36,
-      0x2f, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0xb1, 0xa3,
-      0xff, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0xb1, 0xa3,
-      0xff, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0xb1, 0xa3,
-      0xff, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x99, 0x36, 0x2f, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0xf3, 0x6d, 0x4d, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xff, 0xff,
-      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x57, 0xff, 0xf3, 0x6d,
-      0x4d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x99, 0x36, 0x2f, 0xff, 0xad, 0x85,
-      0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-      0xff, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xff, 0xff,
-      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0x85,
-      0x03, 0xff, 0x99, 0x36, 0x2f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xad, 0x85, 0x03, 0xff, 0xff, 0xff,
-      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0x85,
-      0x03, 0xff, 0xff, 0xd8, 0x57, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xcc, 0x9c,
-      0x00, 0xff, 0xad, 0x85, 0x03, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xad, 0x85,
-      0x03, 0xff, 0xff, 0xd8, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xff, 0xd8, 0x57, 0xff, 0xff, 0xd8,
-      0x57, 0xff, 0xff, 0xd8, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0xf3, 0x6d, 0x4d, 0xff, 0x99, 0x36, 0x2f, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0xf3, 0x6d, 0x4d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x99, 0x36,
-      0x2f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-static const uint32_t sprite_hangyodon_large_idle_1_len = 1174;
-
-// sprites/hangyodon/MEDIUM_IDLE_1.bmp
-static const uint8_t sprite_hangyodon_medium_idle_1[] = {
-      0x42, 0x4d, 0x96, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00,
-      0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
-      0x00, 0x00, 0x01, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x6e,
-      0x69, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0x5c, 0x4f, 0x27, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x5c, 0x4f,
-      0x27, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xcc, 0x9c,
-      0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xcc, 0x9c,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xc2, 0xa1, 0x36, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xc2, 0xa1, 0x36, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xc2, 0xa1, 0x36, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x9c,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xc2, 0xa1, 0x36, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xff, 0xd8,
-      0x57, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd8, 0x57, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xcc, 0x9c,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xa3, 0x88, 0x2f, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xc2, 0xa1, 0x36, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xff, 0xd8,
-      0x57, 0xff, 0xff, 0xd8, 0x57, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xff, 0xd8,
-      0x57, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd8, 0x57, 0xff, 0xff, 0xd8,
-      0x57, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xcc, 0x9c,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb1, 0xa3,
-      0xff, 0xff, 0x7b, 0x71, 0xad, 0xff, 0x7b, 0x71, 0xad, 0xff, 0xb1, 0xa3,
-      0xff, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0xb1, 0xa3,
-      0xff, 0xff, 0x7b, 0x71, 0xad, 0xff, 0x7b, 0x71, 0xad, 0xff, 0xb1, 0xa3,
-      0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x99, 0x36,
-      0x2f, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0xb1, 0xa3,
-      0xff, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0xb1, 0xa3,
-      0xff, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0xb1, 0xa3,
-      0xff, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x99, 0x36, 0x2f, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0xf3, 0x6d, 0x4d, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xff, 0xff,
-      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x57, 0xff, 0xf3, 0x6d,
-      0x4d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x99, 0x36, 0x2f, 0xff, 0xcc, 0x9c,
-      0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-      0xff, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xff, 0xff,
-      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8,
-      0x57, 0xff, 0x99, 0x36, 0x2f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-      0xff, 0xff, 0xff, 0xd8, 0x57, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xcc, 0x9c,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xff, 0xd8, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xff, 0xd8, 0x57, 0xff, 0xff, 0xd8,
-      0x57, 0xff, 0xff, 0xd8, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0xf3, 0x6d, 0x4d, 0xff, 0x99, 0x36, 0x2f, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0xf3, 0x6d, 0x4d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x99, 0x36,
-      0x2f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-static const uint32_t sprite_hangyodon_medium_idle_1_len = 1174;
-
-// sprites/hangyodon/SMALL_IDLE_1.bmp
-static const uint8_t sprite_hangyodon_small_idle_1[] = {
-      0x42, 0x4d, 0x96, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00,
-      0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
-      0x00, 0x00, 0x01, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x6e,
-      0x69, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0x5c, 0x4f, 0x27, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x5c, 0x4f,
-      0x27, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xc2, 0xa1, 0x36, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x9c,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xc2, 0xa1, 0x36, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xc2, 0xa1, 0x36, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xc2, 0xa1, 0x36, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xff, 0xd8, 0x57, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xcc, 0x9c,
-      0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xa3, 0x88, 0x2f, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xc2, 0xa1, 0x36, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xff, 0xd8, 0x57, 0xff, 0xff, 0xd8,
-      0x57, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xcc, 0x9c,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb1, 0xa3,
-      0xff, 0xff, 0x7b, 0x71, 0xad, 0xff, 0x7b, 0x71, 0xad, 0xff, 0xb1, 0xa3,
-      0xff, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0xb1, 0xa3,
-      0xff, 0xff, 0x7b, 0x71, 0xad, 0xff, 0x7b, 0x71, 0xad, 0xff, 0xb1, 0xa3,
-      0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x99, 0x36,
-      0x2f, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0xb1, 0xa3,
-      0xff, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0xb1, 0xa3,
-      0xff, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0xb1, 0xa3, 0xff, 0xff, 0xb1, 0xa3,
-      0xff, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x99, 0x36, 0x2f, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0xf3, 0x6d, 0x4d, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xff, 0xff,
-      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x57, 0xff, 0xf3, 0x6d,
-      0x4d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x99, 0x36, 0x2f, 0xff, 0xcc, 0x9c,
-      0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-      0xff, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xff, 0xff,
-      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8,
-      0x57, 0xff, 0x99, 0x36, 0x2f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-      0xff, 0xff, 0xff, 0xd8, 0x57, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xcc, 0x9c,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xff, 0xd8, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xcc, 0x9c, 0x00, 0xff, 0xef, 0xb7,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0xff, 0xd8, 0x57, 0xff, 0xff, 0xd8,
-      0x57, 0xff, 0xff, 0xd8, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xff, 0xf3, 0x6d, 0x4d, 0xff, 0x99, 0x36, 0x2f, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0xef, 0xb7, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0xf3, 0x6d, 0x4d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x99, 0x36,
-      0x2f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-static const uint32_t sprite_hangyodon_small_idle_1_len = 1174;
-
-// sprites/sayuri/SMALL_IDLE_1.bmp
-static const uint8_t sprite_sayuri_small_idle_1[] = {
-      0x42, 0x4d, 0x96, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00,
-      0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
-      0x00, 0x00, 0x01, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x6e,
-      0x69, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0xe1, 0xa9,
-      0xf3, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0xec, 0xb1, 0xff, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x30, 0x30,
-      0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0xe1, 0xa9,
-      0xf3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0xad, 0xad, 0xff, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x43, 0x43,
-      0xf1, 0xff, 0xad, 0xad, 0xff, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-static const uint32_t sprite_sayuri_small_idle_1_len = 1174;
-
-// sprites/sayuri/SMALL_IDLE_2.bmp
-static const uint8_t sprite_sayuri_small_idle_2[] = {
-      0x42, 0x4d, 0x96, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00,
-      0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
-      0x00, 0x00, 0x01, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x6e,
-      0x69, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30,
-      0xba, 0xff, 0x30, 0x30, 0xba, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x30, 0x30, 0xba, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0xe1, 0xa9,
-      0xf3, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0xec, 0xb1, 0xff, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30,
-      0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0xe1, 0xa9,
-      0xf3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0xad, 0xad, 0xff, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x43, 0x43,
-      0xf1, 0xff, 0xad, 0xad, 0xff, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-static const uint32_t sprite_sayuri_small_idle_2_len = 1174;
-
-// sprites/sayuri/SMALL_IDLE_3.bmp
-static const uint8_t sprite_sayuri_small_idle_3[] = {
-      0x42, 0x4d, 0x96, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00,
-      0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
-      0x00, 0x00, 0x01, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x6e,
-      0x69, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x30, 0x30,
-      0xba, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30,
-      0xba, 0xff, 0x30, 0x30, 0xba, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0xe1, 0xa9,
-      0xf3, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0xec, 0xb1, 0xff, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30,
-      0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0xe1, 0xa9,
-      0xf3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0xad, 0xad, 0xff, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x43, 0x43,
-      0xf1, 0xff, 0xad, 0xad, 0xff, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-static const uint32_t sprite_sayuri_small_idle_3_len = 1174;
-
-// sprites/sayuri/SMALL_TRANSFER_1.bmp
-static const uint8_t sprite_sayuri_small_transfer_1[] = {
-      0x42, 0x4d, 0x96, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00,
-      0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
-      0x00, 0x00, 0x01, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x6e,
-      0x69, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0xe1, 0xa9,
-      0xf3, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0xec, 0xb1, 0xff, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-      0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x30, 0x30,
-      0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0xe1, 0xa9,
-      0xf3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0xad, 0xad, 0xff, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x43, 0x43,
-      0xf1, 0xff, 0xad, 0xad, 0xff, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-static const uint32_t sprite_sayuri_small_transfer_1_len = 1174;
-
-// sprites/sayuri/SMALL_TRANSFER_2.bmp
-static const uint8_t sprite_sayuri_small_transfer_2[] = {
-      0x42, 0x4d, 0x96, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00,
-      0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
-      0x00, 0x00, 0x01, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x6e,
-      0x69, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30,
-      0xba, 0xff, 0x30, 0x30, 0xba, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x30, 0x30, 0xba, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0xe1, 0xa9,
-      0xf3, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0xec, 0xb1, 0xff, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30,
-      0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0xe1, 0xa9,
-      0xf3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0xad, 0xad, 0xff, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x43, 0x43,
-      0xf1, 0xff, 0xad, 0xad, 0xff, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-static const uint32_t sprite_sayuri_small_transfer_2_len = 1174;
-
-// sprites/sayuri/SMALL_TRANSFER_3.bmp
-static const uint8_t sprite_sayuri_small_transfer_3[] = {
-      0x42, 0x4d, 0x96, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00,
-      0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
-      0x00, 0x00, 0x01, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x6e,
-      0x69, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x30, 0x30,
-      0xba, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30,
-      0xba, 0xff, 0x30, 0x30, 0xba, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0xe1, 0xa9,
-      0xf3, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0xec, 0xb1, 0xff, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30,
-      0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0xe1, 0xa9,
-      0xf3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0xad, 0xad, 0xff, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x43, 0x43,
-      0xf1, 0xff, 0xad, 0xad, 0xff, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-static const uint32_t sprite_sayuri_small_transfer_3_len = 1174;
-
-// sprites/sayuri/SMALL_TRANSFER_4.bmp
-static const uint8_t sprite_sayuri_small_transfer_4[] = {
-      0x42, 0x4d, 0x96, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00,
-      0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
-      0x00, 0x00, 0x01, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x6e,
-      0x69, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0xe1, 0xa9,
-      0xf3, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0xec, 0xb1, 0xff, 0xff, 0xff, 0xff,
-      0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x30, 0x30,
-      0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0xe1, 0xa9,
-      0xf3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0xad, 0xad, 0xff, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x43, 0x43,
-      0xf1, 0xff, 0xad, 0xad, 0xff, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-static const uint32_t sprite_sayuri_small_transfer_4_len = 1174;
-
-// sprites/sayuri/SMALL_TRANSFER_5.bmp
-static const uint8_t sprite_sayuri_small_transfer_5[] = {
-      0x42, 0x4d, 0x96, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00,
-      0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
-      0x00, 0x00, 0x01, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x6e,
-      0x69, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30,
-      0xba, 0xff, 0x30, 0x30, 0xba, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x30, 0x30, 0xba, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0xe1, 0xa9,
-      0xf3, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30,
-      0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0xe1, 0xa9,
-      0xf3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0xad, 0xad, 0xff, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x43, 0x43,
-      0xf1, 0xff, 0xad, 0xad, 0xff, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-static const uint32_t sprite_sayuri_small_transfer_5_len = 1174;
-
-// sprites/sayuri/SMALL_TRANSFER_6.bmp
-static const uint8_t sprite_sayuri_small_transfer_6[] = {
-      0x42, 0x4d, 0x96, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00,
-      0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
-      0x00, 0x00, 0x01, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x6e,
-      0x69, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-      0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x30, 0x30,
-      0xba, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30,
-      0xba, 0xff, 0x30, 0x30, 0xba, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0xe1, 0xa9,
-      0xf3, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0xec, 0xb1, 0xff, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30,
-      0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0xe1, 0xa9, 0xf3, 0xff, 0xe1, 0xa9,
-      0xf3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00,
-      0x00, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3d, 0x3d,
-      0xde, 0xff, 0xad, 0xad, 0xff, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b,
-      0x9e, 0xff, 0x30, 0x30, 0xba, 0xff, 0x3d, 0x3d, 0xde, 0xff, 0x43, 0x43,
-      0xf1, 0xff, 0xad, 0xad, 0xff, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b,
-      0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x2b, 0x2b, 0x9e, 0xff, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-static const uint32_t sprite_sayuri_small_transfer_6_len = 1174;
-
-
-// ── Sprite table ──────────────────────────────────────────────────────────────
-// Tier and AnimState values match the enums in main.c.
-
-typedef struct {
-    const uint8_t *data;
-    uint32_t       len;
-    int            tier;       // Tier enum
-    int            state;      // AnimState enum
-    const char    *character;
-} SpriteEntry;
-
-static const SpriteEntry sprite_table[] = {
-    { sprite_djungelskog_large_idle_1, sprite_djungelskog_large_idle_1_len, TIER_LARGE, STATE_IDLE, "djungelskog" },
-    { sprite_djungelskog_medium_idle_1, sprite_djungelskog_medium_idle_1_len, TIER_MEDIUM, STATE_IDLE, "djungelskog" },
-    { sprite_djungelskog_small_idle_1, sprite_djungelskog_small_idle_1_len, TIER_SMALL, STATE_IDLE, "djungelskog" },
-    { sprite_hangyodon_large_idle_1, sprite_hangyodon_large_idle_1_len, TIER_LARGE, STATE_IDLE, "hangyodon" },
-    { sprite_hangyodon_medium_idle_1, sprite_hangyodon_medium_idle_1_len, TIER_MEDIUM, STATE_IDLE, "hangyodon" },
-    { sprite_hangyodon_small_idle_1, sprite_hangyodon_small_idle_1_len, TIER_SMALL, STATE_IDLE, "hangyodon" },
-    { sprite_sayuri_small_idle_1, sprite_sayuri_small_idle_1_len, TIER_SMALL, STATE_IDLE, "sayuri" },
-    { sprite_sayuri_small_idle_2, sprite_sayuri_small_idle_2_len, TIER_SMALL, STATE_IDLE, "sayuri" },
-    { sprite_sayuri_small_idle_3, sprite_sayuri_small_idle_3_len, TIER_SMALL, STATE_IDLE, "sayuri" },
-    { sprite_sayuri_small_transfer_1, sprite_sayuri_small_transfer_1_len, TIER_SMALL, STATE_TRANSFER, "sayuri" },
-    { sprite_sayuri_small_transfer_2, sprite_sayuri_small_transfer_2_len, TIER_SMALL, STATE_TRANSFER, "sayuri" },
-    { sprite_sayuri_small_transfer_3, sprite_sayuri_small_transfer_3_len, TIER_SMALL, STATE_TRANSFER, "sayuri" },
-    { sprite_sayuri_small_transfer_4, sprite_sayuri_small_transfer_4_len, TIER_SMALL, STATE_TRANSFER, "sayuri" },
-    { sprite_sayuri_small_transfer_5, sprite_sayuri_small_transfer_5_len, TIER_SMALL, STATE_TRANSFER, "sayuri" },
-    { sprite_sayuri_small_transfer_6, sprite_sayuri_small_transfer_6_len, TIER_SMALL, STATE_TRANSFER, "sayuri" },};
-
-static const int sprite_table_len = 15;
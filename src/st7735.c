@@ -2,6 +2,13 @@
 #include "pico/stdlib.h"
 #include "hardware/spi.h"
 #include "hardware/gpio.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#if TFT_PIO
+#include "hardware/pio.h"
+#include "hardware/clocks.h"
+#include "st7735.pio.h"
+#endif
 #include <string.h>
 #include <stdlib.h>
 #include <stdbool.h>
@@ -13,35 +20,346 @@ static inline void _cs_hi(void)  { gpio_put(TFT_PIN_CS, 1); }
 static inline void _dc_cmd(void) { gpio_put(TFT_PIN_DC, 0); }
 static inline void _dc_dat(void) { gpio_put(TFT_PIN_DC, 1); }
 
-static void _cmd(uint8_t cmd) {
-    _dc_cmd(); _cs_lo();
+// ── Transport ─────────────────────────────────────────────────────────────────
+// Everything reaches the panel through these: between _tx_begin() and
+// _tx_end() go command bytes, their data, and pixel data in wire order
+// (len bytes, after a RAMWR and _tx_open()).
+
+static uint32_t _bus_hz;            // the clock the panel is written at
+
+#if TFT_PIO
+// The state machine takes packets of a header word and its items, one FIFO
+// word each (see st7735.pio), and sets DC itself from the header.
+#define PIO_HDR(dc, bits, items) \
+    ((uint32_t)(dc) << 31 | (uint32_t)((bits) - 1) << 27 | (uint32_t)((items) - 1) << 11)
+
+static uint _pio_sm;
+static bool _pio_pins;              // SCK/MOSI routed to the PIO
+
+static void _pio_init(void) {
+    uint offset = pio_add_program(TFT_PIO_INST, &st7735_program);
+    _pio_sm = pio_claim_unused_sm(TFT_PIO_INST, true);
+    float div = (float)clock_get_hz(clk_sys) / (2.0f * TFT_PIO_HZ);
+    if (div < 1.0f) div = 1.0f;
+    st7735_program_init(TFT_PIO_INST, _pio_sm, offset, TFT_PIN_SCK, TFT_PIN_MOSI,
+                        TFT_PIN_DC, div);
+    _bus_hz = (uint32_t)((float)clock_get_hz(clk_sys) / (2.0f * div));
+}
+
+// Hand SCK/MOSI to the PIO (display) or back to the SPI peripheral (SD).
+// Both idle SCK low, and the panel is deselected whenever this runs.
+static void _pio_route(bool pio) {
+    if (pio == _pio_pins) return;
+    if (pio) {
+        pio_gpio_init(TFT_PIO_INST, TFT_PIN_SCK);
+        pio_gpio_init(TFT_PIO_INST, TFT_PIN_MOSI);
+    } else {
+        gpio_set_function(TFT_PIN_SCK,  GPIO_FUNC_SPI);
+        gpio_set_function(TFT_PIN_MOSI, GPIO_FUNC_SPI);
+    }
+    _pio_pins = pio;
+}
+
+// Wait for the FIFO to empty and the last bit to leave the pin
+static void _pio_drain(void) {
+    uint32_t stall = 1u << (PIO_FDEBUG_TXSTALL_LSB + _pio_sm);
+    TFT_PIO_INST->fdebug = stall;
+    while (!(TFT_PIO_INST->fdebug & stall)) tight_loop_contents();
+}
+
+static inline void _pio_put(uint32_t w) {
+    pio_sm_put_blocking(TFT_PIO_INST, _pio_sm, w);
+}
+
+static void _tx_begin(void) { _pio_route(true); _cs_lo(); }
+static void _tx_end(void)   { _pio_drain(); _cs_hi(); }
+static void _tx_open(void)  { }
+
+static void _tx_cmd(uint8_t cmd) {
+    _pio_put(PIO_HDR(0, 8, 1));
+    _pio_put((uint32_t)cmd << 24);
+}
+
+static void _tx_data(const uint8_t *buf, int len) {
+    _pio_put(PIO_HDR(1, 8, len));
+    for (int i = 0; i < len; i++) _pio_put((uint32_t)buf[i] << 24);
+}
+
+static void _tx_pixels(const void *buf, int len) {
+    const uint8_t *p = buf;
+#if TFT_RGB444
+    _tx_data(p, len);
+#else
+    _pio_put(PIO_HDR(1, 16, len / 2));
+    for (int i = 0; i < len; i += 2) _pio_put((uint32_t)p[i] << 24 | (uint32_t)p[i + 1] << 16);
+#endif
+}
+#else
+static bool _spi_ours;              // spi0 still at _bus_hz
+
+// The SD card runs spi0 at its own baud: take the panel's back
+static void _tx_begin(void) {
+    if (!_spi_ours) {
+        spi_set_baudrate(TFT_SPI, TFT_SPI_HZ);
+        _spi_ours = true;
+    }
+    _cs_lo();
+}
+static void _tx_end(void)   { _cs_hi(); }     // spi_write_blocking has drained
+static void _tx_open(void)  { _dc_dat(); }
+
+static void _tx_cmd(uint8_t cmd) {
+    _dc_cmd();
     spi_write_blocking(TFT_SPI, &cmd, 1);
-    _cs_hi();
 }
 
-static void _data(const uint8_t *buf, size_t len) {
-    _dc_dat(); _cs_lo();
+static void _tx_data(const uint8_t *buf, int len) {
+    _dc_dat();
     spi_write_blocking(TFT_SPI, buf, len);
-    _cs_hi();
 }
 
-static void _data1(uint8_t b) { _data(&b, 1); }
+static void _tx_pixels(const void *buf, int len) {
+    spi_write_blocking(TFT_SPI, buf, len);
+}
+#endif
+
+void tft_release_bus(void) {
+    tft_wait();
+#if TFT_PIO
+    _pio_route(false);
+#else
+    _spi_ours = false;
+#endif
+}
+
+uint32_t tft_bus_hz(void) {
+    return _bus_hz;
+}
+
+// ── Command lists ─────────────────────────────────────────────────────────────
+// Commands are recorded as  cmd, n, n data bytes  — bit 7 of n (CL_DELAY)
+// adds a 16-bit ms delay after the data — and sent in one pass: CS goes
+// low once and DC flips between command and data bytes inline.  The window
+// and MADCTL last sent are remembered and left out when unchanged.
+
+#define CL_DELAY  0x80
+#define CL_BYTES  32
+
+static uint8_t _cl[CL_BYTES];
+static int     _cl_len;
+static int     _win_x0 = -1, _win_x1, _win_y0 = -1, _win_y1;   // -1 unknown
+static int     _madctl = -1;
+
+// Send a list.  With open set the panel is left selected, ready for the
+// pixels that follow a RAMWR.
+static void _cl_exec(const uint8_t *p, int len, bool open) {
+    const uint8_t *end = p + len;
+    tft_wait();
+    _tx_begin();
+    while (p < end) {
+        uint8_t cmd = *p++;
+        uint8_t n   = *p & ~CL_DELAY;
+        bool    pause = *p++ & CL_DELAY;
+        _tx_cmd(cmd);
+        if (n) {
+            _tx_data(p, n);
+            p += n;
+        }
+        if (pause) {
+            sleep_ms((p[0] << 8) | p[1]);
+            p += 2;
+        }
+    }
+    if (open) _tx_open();
+    else      _tx_end();
+}
+
+static void _cl_flush(bool open) {
+    _cl_exec(_cl, _cl_len, open);
+    _cl_len = 0;
+}
+
+static void _cl_cmd(uint8_t cmd, const uint8_t *data, int n) {
+    if (_cl_len + 2 + n > CL_BYTES) _cl_flush(false);
+    _cl[_cl_len++] = cmd;
+    _cl[_cl_len++] = n;
+    if (n) memcpy(&_cl[_cl_len], data, n);
+    _cl_len += n;
+}
 
+static void _cl_madctl(uint8_t v) {
+    if (v == _madctl) return;
+    _madctl = v;
+    _cl_cmd(0x36, &v, 1);
+}
+
+// Every drawing operation starts here, so this is where a DMA transfer
+// still in flight hands the bus back.  Leaves the panel selected for pixels.
 static void _window(int x0, int y0, int x1, int y1) {
     x0 += TFT_XOFF; x1 += TFT_XOFF;
     y0 += TFT_YOFF; y1 += TFT_YOFF;
-    uint8_t xb[4] = { x0>>8, x0, x1>>8, x1 };
-    uint8_t yb[4] = { y0>>8, y0, y1>>8, y1 };
-    _cmd(0x2A); _data(xb, 4);   // CASET
-    _cmd(0x2B); _data(yb, 4);   // RASET
-    _cmd(0x2C);                  // RAMWR
+    if (x0 != _win_x0 || x1 != _win_x1) {
+        uint8_t xb[4] = { x0>>8, x0, x1>>8, x1 };
+        _cl_cmd(0x2A, xb, 4);       // CASET
+        _win_x0 = x0; _win_x1 = x1;
+    }
+    if (y0 != _win_y0 || y1 != _win_y1) {
+        uint8_t yb[4] = { y0>>8, y0, y1>>8, y1 };
+        _cl_cmd(0x2B, yb, 4);       // RASET
+        _win_y0 = y0; _win_y1 = y1;
+    }
+    _cl_cmd(0x2C, NULL, 0);         // RAMWR
+    _cl_flush(true);
+}
+
+// ── Scroll mapping ────────────────────────────────────────────────────────────
+// Drawing coordinates are always screen rows.  While a scroll region is set,
+// screen row y inside it lives at GRAM row top + (y - top + offset) mod h,
+// so a window may have to be split where that wraps.
+
+static int _scroll_top, _scroll_h, _scroll_off;    // _scroll_h 0 = off
+
+// GRAM row for screen row y; *run = rows from y that follow on contiguously
+static int _map_row(int y, int *run) {
+    int top = _scroll_top, h = _scroll_h;
+    if (h == 0 || y >= top + h) { *run = TFT_H - y; return y; }
+    if (y < top)                { *run = top - y;   return y; }
+    int r = y - top + _scroll_off;
+    if (r >= h) r -= h;
+    *run = (h - r < top + h - y) ? h - r : top + h - y;
+    return top + r;
+}
+
+// Open a data window on columns [x, x+w) for as many of the h screen rows
+// from y as are contiguous in GRAM, and return how many that is.
+static int _open_rows(int x, int y, int w, int h) {
+    int run;
+    int gy = _map_row(y, &run);
+    if (run > h) run = h;
+    _window(x, gy, x+w-1, gy+run-1);
+    return run;
+}
+
+// ── DMA transfers ─────────────────────────────────────────────────────────────
+// One channel paces bytes into the SPI TX FIFO, or halfwords into the PIO's.
+// CS stays low for the whole transfer; the completion IRQ releases it.  A window can be
+// fed in several transfers, in which case only the last one releases CS.
+
+static int           _dma_ch = -1;
+static volatile bool _dma_busy;
+static bool          _dma_release;
+static tft_done_fn   _dma_done;
+static void         *_dma_ctx;
+
+static void _dma_irq(void) {
+    if (_dma_ch < 0 || !dma_channel_get_irq0_status(_dma_ch)) return;
+    dma_channel_acknowledge_irq0(_dma_ch);
+
+#if TFT_PIO
+    // The last words have only reached the FIFO
+    if (_dma_release) _tx_end();
+#else
+    // TX-only DMA leaves stale bytes and an overrun in the RX FIFO, which
+    // the SD card's next read would pick up.
+    while (spi_is_readable(TFT_SPI)) (void)spi_get_hw(TFT_SPI)->dr;
+
+    if (_dma_release) {
+        // The last byte has only entered the FIFO; let it clock out before
+        // deselecting the panel.
+        while (spi_is_busy(TFT_SPI)) tight_loop_contents();
+        _cs_hi();
+        while (spi_is_readable(TFT_SPI)) (void)spi_get_hw(TFT_SPI)->dr;
+        spi_get_hw(TFT_SPI)->icr = SPI_SSPICR_RORIC_BITS;
+    }
+#endif
+
+    tft_done_fn done = _dma_done;
+    void       *ctx  = _dma_ctx;
+    _dma_busy = false;
+    if (done) done(ctx);
+}
+
+static void _dma_init(void) {
+    _dma_ch = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(_dma_ch);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+#if TFT_PIO
+    // Pixels are big-endian in memory; the byte swap makes each halfword
+    // the native RGB565 value the state machine shifts out MSB first
+    channel_config_set_transfer_data_size(&c, TFT_RGB444 ? DMA_SIZE_8 : DMA_SIZE_16);
+    channel_config_set_bswap(&c, !TFT_RGB444);
+    channel_config_set_dreq(&c, pio_get_dreq(TFT_PIO_INST, _pio_sm, true));
+    dma_channel_configure(_dma_ch, &c, &TFT_PIO_INST->txf[_pio_sm], NULL, 0, false);
+#else
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, spi_get_dreq(TFT_SPI, true));
+    dma_channel_configure(_dma_ch, &c, &spi_get_hw(TFT_SPI)->dr, NULL, 0, false);
+#endif
+
+    dma_channel_set_irq0_enabled(_dma_ch, true);
+    irq_add_shared_handler(DMA_IRQ_0, _dma_irq,
+                           PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+}
+
+// Queue len bytes of pixel data into the open window
+static void _dma_send(const void *buf, uint32_t len, bool release,
+                      tft_done_fn done, void *ctx) {
+    tft_wait();
+    _dma_release = release;
+    _dma_done    = done;
+    _dma_ctx     = ctx;
+    _dma_busy    = true;
+#if TFT_PIO
+    uint32_t items = TFT_RGB444 ? len : len / 2;
+    _pio_put(PIO_HDR(1, TFT_RGB444 ? 8 : 16, items));
+    dma_channel_transfer_from_buffer_now(_dma_ch, buf, items);
+#else
+    dma_channel_transfer_from_buffer_now(_dma_ch, buf, len);
+#endif
+}
+
+#if !TFT_RGB444
+static void _blit_async(const uint8_t *buf, int x, int y, int w, int h,
+                        tft_done_fn done, void *ctx) {
+    while (h > 0) {
+        int run = _open_rows(x, y, w, h);
+        bool last = (run == h);
+        _dma_send(buf, run * w * 2, true, last ? done : NULL, ctx);
+        buf += run * w * 2;
+        y   += run;
+        h   -= run;
+    }
+}
+#endif
+
+bool tft_busy(void) {
+    return _dma_busy;
+}
+
+void tft_wait(void) {
+    while (_dma_busy) tight_loop_contents();
 }
 
 // ── Initialisation ────────────────────────────────────────────────────────────
 
+#if TFT_RGB444
+#define TFT_COLMOD  TFT_COLMOD_12
+#else
+#define TFT_COLMOD  TFT_COLMOD_16
+#endif
+
+// The panel's script, then colour depth and display on
+static const uint8_t _init_seq[] = {
+    TFT_INIT_SEQ
+    0x3A, 1 | CL_DELAY, TFT_COLMOD, 0, 10,          // COLMOD
+    0x13, CL_DELAY, 0, 10,                          // NORON
+    0x29, CL_DELAY, 0, 100,                         // DISPON
+};
+
 void tft_init(void) {
-    // SPI0 at 40 MHz
-    spi_init(TFT_SPI, 40 * 1000 * 1000);
+    _bus_hz = spi_init(TFT_SPI, TFT_SPI_HZ);   // the PIO's clock instead, below
     spi_set_format(TFT_SPI, 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
     gpio_set_function(TFT_PIN_SCK,  GPIO_FUNC_SPI);
     gpio_set_function(TFT_PIN_MOSI, GPIO_FUNC_SPI);
@@ -49,60 +367,125 @@ void tft_init(void) {
 
     // Control pins
     gpio_init(TFT_PIN_CS);  gpio_set_dir(TFT_PIN_CS,  GPIO_OUT); gpio_put(TFT_PIN_CS,  1);
+#if !TFT_PIO
     gpio_init(TFT_PIN_DC);  gpio_set_dir(TFT_PIN_DC,  GPIO_OUT); gpio_put(TFT_PIN_DC,  0);
+#endif
     gpio_init(TFT_PIN_RST); gpio_set_dir(TFT_PIN_RST, GPIO_OUT); gpio_put(TFT_PIN_RST, 1);
     gpio_init(TFT_PIN_BL);  gpio_set_dir(TFT_PIN_BL,  GPIO_OUT); gpio_put(TFT_PIN_BL,  1);
     gpio_init(SD_PIN_CS);   gpio_set_dir(SD_PIN_CS,   GPIO_OUT); gpio_put(SD_PIN_CS,   1);
+#if TFT_PIO
+    _pio_init();                    // takes DC over from SIO
+#else
+    _spi_ours = true;
+#endif
+    _dma_init();
 
     // Hard reset
     gpio_put(TFT_PIN_RST, 0); sleep_ms(50);
     gpio_put(TFT_PIN_RST, 1); sleep_ms(120);
 
-    // Init sequence for ST7735R
-    _cmd(0x01); sleep_ms(150);              // SWRESET
-    _cmd(0x11); sleep_ms(500);              // SLPOUT
-
-    _cmd(0xB1); _data1(0x01); _data1(0x2C); _data1(0x2D);  // FRMCTR1
-    _cmd(0xB2); _data1(0x01); _data1(0x2C); _data1(0x2D);  // FRMCTR2
-    _cmd(0xB3);                                              // FRMCTR3
-        _data1(0x01); _data1(0x2C); _data1(0x2D);
-        _data1(0x01); _data1(0x2C); _data1(0x2D);
-    _cmd(0xB4); _data1(0x07);               // INVCTR
-    _cmd(0xC0); _data1(0xA2); _data1(0x02); _data1(0x84);  // PWCTR1
-    _cmd(0xC1); _data1(0xC5);               // PWCTR2
-    _cmd(0xC2); _data1(0x0A); _data1(0x00); // PWCTR3
-    _cmd(0xC3); _data1(0x8A); _data1(0x2A); // PWCTR4
-    _cmd(0xC4); _data1(0x8A); _data1(0xEE); // PWCTR5
-    _cmd(0xC5); _data1(0x0E);               // VMCTR1
-    _cmd(0x21);                             // INVON
-    _cmd(0x36); _data1(0x08);              // MADCTL: no mirroring, portrait, RGB
-    _cmd(0x3A); _data1(0x05); sleep_ms(10); // COLMOD 16-bit
-    _cmd(0x13); sleep_ms(10);               // NORON
-    _cmd(0x29); sleep_ms(100);              // DISPON
+    _win_x0 = _win_y0 = -1;
+    _madctl = -1;
+    _cl_exec(_init_seq, sizeof _init_seq, false);
+    _cl_madctl(TFT_MADCTL);
+    _cl_flush(false);
 
     tft_fill(COL_BLACK);
 }
 
+// ── 12-bit transport ──────────────────────────────────────────────────────────
+// With TFT_RGB444 the panel takes 4:4:4 pixels, two to three bytes:
+//   R1G1 B1R2 G2B2
+// Pixels are still produced as RGB565 big-endian everywhere and packed just
+// before they go on the wire, dropping the low bit of red/blue and the low
+// two of green.
+
+#if TFT_RGB444
+static inline uint16_t _rgb444(uint16_t be) {
+    uint16_t c = SWAP16(be);
+    return ((c >> 12) << 8) | (((c >> 7) & 0x0F) << 4) | ((c >> 1) & 0x0F);
+}
+
+// Pack n RGB565 big-endian pixels into dst, which may be src itself; returns
+// the byte count.  An odd last pixel leaves a padding nibble.
+static uint32_t _pack444(const uint16_t *src, int n, uint8_t *dst) {
+    uint8_t *d = dst;
+    int i = 0;
+    for (; i + 1 < n; i += 2) {
+        uint16_t a = _rgb444(src[i]);
+        uint16_t b = _rgb444(src[i + 1]);
+        d[0] = a >> 4;
+        d[1] = (a << 4) | (b >> 8);
+        d[2] = b;
+        d += 3;
+    }
+    if (i < n) {
+        uint16_t a = _rgb444(src[i]);
+        d[0] = a >> 4;
+        d[1] = a << 4;
+        d += 2;
+    }
+    return d - dst;
+}
+#endif
+
 // ── Drawing ───────────────────────────────────────────────────────────────────
 
-void tft_fill_rect(int x, int y, int w, int h, uint16_t colour_be) {
+static void _fill_rect(int x, int y, int w, int h, uint16_t colour_be) {
     if (w <= 0 || h <= 0) return;
-    _window(x, y, x+w-1, y+h-1);
-    _dc_dat(); _cs_lo();
-    int total = w * h;
     // Send in 256-pixel chunks
-    uint8_t chunk[512];
-    for (int i = 0; i < 512; i += 2) {
-        chunk[i]   = colour_be >> 8;
-        chunk[i+1] = colour_be & 0xFF;
+#if TFT_RGB444
+    uint8_t  chunk[384];
+    uint16_t c = _rgb444(colour_be);
+    for (int i = 0; i < 384; i += 3) {
+        chunk[i]   = c >> 4;
+        chunk[i+1] = (c << 4) | (c >> 8);
+        chunk[i+2] = c;
     }
-    while (total >= 256) {
-        spi_write_blocking(TFT_SPI, chunk, 512);
-        total -= 256;
+#else
+    uint16_t chunk[256];            // colour_be is already in wire order
+    for (int i = 0; i < 256; i++) chunk[i] = colour_be;
+#endif
+    while (h > 0) {
+        int run   = _open_rows(x, y, w, h);
+        int total = run * w;
+        while (total >= 256) {
+            _tx_pixels(chunk, sizeof chunk);
+            total -= 256;
+        }
+        if (total > 0)
+            _tx_pixels(chunk, TFT_RGB444 ? (total * 3 + 1) / 2 : total * 2);
+        _tx_end();
+        y += run;
+        h -= run;
     }
-    if (total > 0)
-        spi_write_blocking(TFT_SPI, chunk, total * 2);
-    _cs_hi();
+}
+
+static void _blit(const uint8_t *buf, int x, int y, int w, int h) {
+    while (h > 0) {
+        int run = _open_rows(x, y, w, h);
+#if TFT_RGB444
+        // Pack 256 pixels at a time; chunks stay even so no nibble is split
+        uint16_t px[256];
+        uint8_t  packed[384];
+        int total = run * w;
+        for (int i = 0; i < total; i += 256) {
+            int n = (total - i < 256) ? total - i : 256;
+            memcpy(px, buf + i * 2, n * 2);
+            _tx_pixels(packed, _pack444(px, n, packed));
+        }
+#else
+        _tx_pixels(buf, run * w * 2);
+#endif
+        _tx_end();
+        buf += run * w * 2;
+        y   += run;
+        h   -= run;
+    }
+}
+
+void tft_fill_rect(int x, int y, int w, int h, uint16_t colour_be) {
+    _fill_rect(x, y, w, h, colour_be);
 }
 
 void tft_fill(uint16_t colour_be) {
@@ -110,135 +493,155 @@ void tft_fill(uint16_t colour_be) {
 }
 
 void tft_blit(const uint8_t *buf, int x, int y, int w, int h) {
-    _window(x, y, x+w-1, y+h-1);
-    _dc_dat(); _cs_lo();
-    spi_write_blocking(TFT_SPI, buf, w * h * 2);
-    _cs_hi();
-}
-
-void tft_blit_scaled(const uint8_t *buf, int sw, int sh, bool clear_border) {
-    // Largest integer scale that fits in TFT_W x TFT_H
-    int scale = TFT_W / sw;
-    if (TFT_H / sh < scale) scale = TFT_H / sh;
-    if (scale < 1) scale = 1;
-
-    int dw = sw * scale;
-    int dh = sh * scale;
-    int ox = (TFT_W - dw) / 2;
-    int oy = (TFT_H - dh) / 2;
-
-    // Clear letterbox strips only (avoids full-screen flash)
-    if (clear_border) {
-        if (oy > 0) {
-            tft_fill_rect(0, 0,       TFT_W, oy,              COL_BLACK);
-            tft_fill_rect(0, oy+dh,   TFT_W, TFT_H-oy-dh,    COL_BLACK);
-        }
-        if (ox > 0) {
-            tft_fill_rect(0,    oy, ox,           dh, COL_BLACK);
-            tft_fill_rect(ox+dw,oy, TFT_W-ox-dw, dh, COL_BLACK);
-        }
-    }
+    _blit(buf, x, y, w, h);
+}
 
-    // Build scaled buffer on the stack (max 80×80×2 = 12800 bytes)
-    // For 16×16 @ 5× = 80×80 = 12800 bytes — fine for stack
-    uint8_t *scaled = malloc(dw * dh * 2);
-    if (!scaled) return;
-
-    for (int row = 0; row < sh; row++) {
-        for (int col = 0; col < sw; col++) {
-            int src = (row * sw + col) * 2;
-            uint8_t hi = buf[src];
-            uint8_t lo = buf[src+1];
-            for (int dy = 0; dy < scale; dy++) {
-                int dst_row = row * scale + dy;
-                for (int dx = 0; dx < scale; dx++) {
-                    int dst = (dst_row * dw + col * scale + dx) * 2;
-                    scaled[dst]   = hi;
-                    scaled[dst+1] = lo;
-                }
-            }
-        }
-    }
+// ── Line streaming ────────────────────────────────────────────────────────────
+// A window is filled top to bottom a line at a time in one of two static
+// band buffers: each full band goes out by DMA while the next is built in
+// the other, so the panel starts receiving pixels after the first band and
+// memory stays at two bands whatever is being drawn.  A transfer only ever
+// reads the buffer it was given and each new one waits for the last, so the
+// buffer being filled is always free.  CS stays low until the last band.
+
+static uint16_t  _band[2][TFT_BAND_PIXELS];
+static int       _band_next;
+static uint16_t *_st_band;
+static int       _st_w, _st_lines, _st_n;
+static int       _st_x, _st_y, _st_left, _st_run;  // rows still to come
+
+// Queue the current band and switch to the other buffer
+static void _band_send(bool release) {
+    int      n   = _st_n * _st_w;
+#if TFT_RGB444
+    uint32_t len = _pack444(_st_band, n, (uint8_t *)_st_band);
+#else
+    uint32_t len = n * 2;
+#endif
+    _dma_send(_st_band, len, release, NULL, NULL);
+    _band_next ^= 1;
+}
 
-    tft_blit(scaled, ox, oy, dw, dh);
-    free(scaled);
-}
-
-// ── Composite blit: BG (RGB565, full size) + character (RGBA8888, scaled) ─────
-// bg_buf:   RGB565 big-endian, exactly TFT_W * TFT_H * 2 bytes
-// chr_buf:  RGBA8888, chr_w * chr_h * 4 bytes
-// Scales character by largest integer factor, centres it, alpha-composites.
-// Produces a single blit to the display.
-void tft_composite_blit(const uint8_t *bg_buf,
-                         const uint8_t *chr_buf, int chr_w, int chr_h) {
-    // Pick scale
-    int scale = TFT_W / chr_w;
-    if (TFT_H / chr_h < scale) scale = TFT_H / chr_h;
-    if (scale < 1) scale = 1;
-
-    int dw = chr_w * scale;
-    int dh = chr_h * scale;
-    int ox = (TFT_W - dw) / 2;
-    int oy = (TFT_H - dh) / 2;
-
-    // Composite into a TFT_W * TFT_H RGB565 buffer
-    uint8_t *comp = malloc(TFT_W * TFT_H * 2);
-    if (!comp) return;
-
-    // Start with BG
-    if (bg_buf) {
-        memcpy(comp, bg_buf, TFT_W * TFT_H * 2);
-    } else {
-        // No BG — fill black
-        memset(comp, 0, TFT_W * TFT_H * 2);
+static void _stream_begin(int x, int y, int w, int h) {
+    _st_x     = x;
+    _st_y     = y;
+    _st_left  = h;
+    _st_run   = _open_rows(x, y, w, h);
+    _st_band  = _band[_band_next];
+    _st_w     = w;
+    _st_lines = TFT_BAND_PIXELS / w;
+    _st_n     = 0;
+#if TFT_RGB444
+    if (w & 1) _st_lines &= ~1;     // whole pixel pairs per band
+#endif
+}
+
+static uint16_t *_stream_line(void) {
+    if (_st_run == 0) {
+        // The rows wrap in GRAM: finish this window and open the next
+        _band_send(true);
+        _st_band = _band[_band_next];
+        _st_n    = 0;
+        _st_run  = _open_rows(_st_x, _st_y, _st_w, _st_left);
+    } else if (_st_n == _st_lines) {
+        _band_send(false);
+        _st_band = _band[_band_next];
+        _st_n    = 0;
     }
+    _st_run--;
+    _st_left--;
+    _st_y++;
+    return _st_band + _st_n++ * _st_w;
+}
 
-    // Alpha-composite scaled character on top
-    if (chr_buf) {
-        for (int row = 0; row < chr_h; row++) {
-            for (int col = 0; col < chr_w; col++) {
-                const uint8_t *src = chr_buf + (row * chr_w + col) * 4;
-                uint8_t r_s = src[0];
-                uint8_t g_s = src[1];
-                uint8_t b_s = src[2];
-                uint8_t a   = src[3];
-                if (a == 0) continue;   // fully transparent, skip
-
-                for (int dy = 0; dy < scale; dy++) {
-                    int py = oy + row * scale + dy;
-                    if (py < 0 || py >= TFT_H) continue;
-                    for (int dx = 0; dx < scale; dx++) {
-                        int px = ox + col * scale + dx;
-                        if (px < 0 || px >= TFT_W) continue;
-
-                        int idx = (py * TFT_W + px) * 2;
-                        uint16_t dst_px = ((uint16_t)comp[idx] << 8) | comp[idx+1];
-
-                        // Unpack destination RGB565
-                        uint8_t r_d = (dst_px >> 11) << 3;
-                        uint8_t g_d = ((dst_px >> 5) & 0x3F) << 2;
-                        uint8_t b_d = (dst_px & 0x1F) << 3;
-
-                        // Alpha blend
-                        uint8_t r_o = (r_s * a + r_d * (255 - a)) / 255;
-                        uint8_t g_o = (g_s * a + g_d * (255 - a)) / 255;
-                        uint8_t b_o = (b_s * a + b_d * (255 - a)) / 255;
-
-                        uint16_t out_px = ((r_o & 0xF8) << 8) |
-                                          ((g_o & 0xFC) << 3) |
-                                           (b_o >> 3);
-                        comp[idx]   = (out_px >> 8) & 0xFF;
-                        comp[idx+1] =  out_px & 0xFF;
-                    }
-                }
-            }
-        }
+static void _stream_end(void) {
+    if (_st_n == 0) {               // empty window
+        tft_wait();
+        _tx_end();
+        return;
     }
+    _band_send(true);
+}
+
+void tft_stream_begin(int x, int y, int w, int h) {
+    _stream_begin(x, y, w, h);
+}
 
-    // Single blit
-    _window(0, 0, TFT_W-1, TFT_H-1);
-    _dc_dat(); _cs_lo();
-    spi_write_blocking(TFT_SPI, comp, TFT_W * TFT_H * 2);
-    _cs_hi();
-    free(comp);
-}
\ No newline at end of file
+uint16_t *tft_stream_line(void) {
+    return _stream_line();
+}
+
+void tft_stream_end(void) {
+    _stream_end();
+}
+
+void tft_blit_async(const uint8_t *buf, int x, int y, int w, int h,
+                    tft_done_fn done, void *ctx) {
+#if TFT_RGB444
+    // buf can't be packed in place, so it is copied through the bands and
+    // is free again on return
+    _stream_begin(x, y, w, h);
+    for (int row = 0; row < h; row++)
+        memcpy(_stream_line(), buf + row * w * 2, w * 2);
+    _stream_end();
+    if (done) done(ctx);
+#else
+    _blit_async(buf, x, y, w, h, done, ctx);
+#endif
+}
+
+// ── Hardware scrolling ────────────────────────────────────────────────────────
+
+void tft_scroll_area(int top, int h) {
+    if (h <= 0 || top < 0 || top + h > TFT_H) h = 0;
+    tft_wait();
+    _scroll_top = top;
+    _scroll_h   = h;
+    _scroll_off = 0;
+    int tfa = TFT_YOFF + (h ? top : 0);
+    int vsa = h ? h : TFT_H;
+    int bfa = TFT_GRAM_H - tfa - vsa;
+    uint8_t def[6] = { tfa >> 8, tfa, vsa >> 8, vsa, bfa >> 8, bfa };
+    _cl_cmd(0x33, def, 6);                       // VSCRDEF
+    _cl_cmd(0x37, def, 2);                       // VSCSAD
+    _cl_flush(false);
+}
+
+void tft_scroll(int dy) {
+    if (_scroll_h == 0) return;
+    tft_wait();
+    _scroll_off = ((_scroll_off + dy) % _scroll_h + _scroll_h) % _scroll_h;
+    int ssa = TFT_YOFF + _scroll_top + _scroll_off;
+    uint8_t sa[2] = { ssa >> 8, ssa };
+    _cl_cmd(0x37, sa, 2);                        // VSCSAD
+    _cl_flush(false);
+}
+
+int tft_scroll_offset(void) {
+    return _scroll_off;
+}
+
+// ── Fitting ───────────────────────────────────────────────────────────────────
+
+void tft_fit(int sw, int sh, tft_fit_mode mode, int *x, int *y, int *w, int *h) {
+    int dw, dh;
+    if (mode == TFT_FIT_STRETCH) {
+        dw = TFT_W;
+        dh = TFT_H;
+    } else if (mode == TFT_FIT_ASPECT) {
+        if (sw * TFT_H <= sh * TFT_W) { dh = TFT_H; dw = sw * TFT_H / sh; }
+        else                          { dw = TFT_W; dh = sh * TFT_W / sw; }
+        if (dw < 1) dw = 1;
+        if (dh < 1) dh = 1;
+    } else {
+        int scale = TFT_W / sw;
+        if (TFT_H / sh < scale) scale = TFT_H / sh;
+        if (scale < 1) scale = 1;
+        dw = sw * scale;
+        dh = sh * scale;
+    }
+    *x = (TFT_W - dw) / 2;
+    *y = (TFT_H - dh) / 2;
+    *w = dw;
+    *h = dh;
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include <stdint.h>
+#include <stdbool.h>
 #include "hardware/spi.h"
 
 // ── Wiring ────────────────────────────────────────────────────────────────────
@@ -27,11 +28,42 @@
 #define SD_PIN_CS     15
 
 // ── Display geometry ─────────────────────────────────────────────────────────
-// Physical orientation: portrait, 80 wide x 160 tall
-#define TFT_W         80
-#define TFT_H         160
-#define TFT_XOFF      26    // ST7735 GRAM offset for this panel
-#define TFT_YOFF      1
+// TFT_W, TFT_H, GRAM offsets, clocks and init script come from the panel
+// descriptor picked at build time (panel.h).  Portrait orientation.
+#include "panel.h"
+
+// ── Bands ────────────────────────────────────────────────────────────────────
+// Streamed windows go out in bands of this many pixels (8 full-width
+// lines), one filling while DMA sends the other.
+#define TFT_BAND_PIXELS    (TFT_W * 8)
+
+// ── Colour depth ─────────────────────────────────────────────────────────────
+// TFT_RGB444=1 (CMake -DTAMAGOTCHI_RGB444=ON) drives the panel in 12-bit
+// colour, COLMOD 0x03: 1.5 bytes per pixel instead of 2, a quarter less
+// time on the spi0 bus the SD card shares.  The API is unchanged — callers
+// still hand over RGB565 big-endian and it is packed on the way out.
+#ifndef TFT_RGB444
+#define TFT_RGB444 0
+#endif
+
+// ── Transport ────────────────────────────────────────────────────────────────
+// TFT_PIO=1 (CMake -DTAMAGOTCHI_PIO=ON) drives the panel from a PIO state
+// machine instead of the SPI peripheral: DMA feeds it 16-bit pixel words,
+// the program sets DC itself, and SCK runs at up to TFT_PIO_HZ (by default
+// the panel's TFT_MAX_HZ).  The SD card
+// keeps the SPI peripheral on the same SCK/MOSI pins, so it calls
+// tft_release_bus() before using them; the display takes them back the next
+// time it draws.
+#ifndef TFT_PIO
+#define TFT_PIO 0
+#endif
+#define TFT_PIO_INST  pio0
+#ifndef TFT_PIO_HZ
+#define TFT_PIO_HZ    TFT_MAX_HZ
+#endif
+
+// What actually goes over the wire, for sizing
+#define TFT_BPP       (TFT_RGB444 ? 12 : 16)
 
 // ── Colour helpers ────────────────────────────────────────────────────────────
 #define RGB565(r,g,b) ((uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)))
@@ -50,7 +82,59 @@ void     tft_fill(uint16_t colour_be);
 void     tft_fill_rect(int x, int y, int w, int h, uint16_t colour_be);
 void     tft_blit(const uint8_t *buf, int x, int y, int w, int h);
 
-// Scale src (sw×sh, RGB565 big-endian) up to fit TFT_W×TFT_H,
-// centred with black letterbox.  Only redraws letterbox on first call
-// or when clear_border is true.
-void     tft_blit_scaled(const uint8_t *buf, int sw, int sh, bool clear_border);
+// ── Fitting ──────────────────────────────────────────────────────────────────
+// How a scaled source fills the screen, always centred.  The scene stretches
+// sprite layers over the result with cached nearest-neighbour maps (see
+// blit.h), whatever the mode.
+typedef enum {
+    TFT_FIT_INTEGER,    // largest whole-number scale that fits (default)
+    TFT_FIT_ASPECT,     // as large as fits, aspect ratio kept
+    TFT_FIT_STRETCH,    // the whole screen
+} tft_fit_mode;
+
+// Screen rectangle (x, y, w, h) a sw×sh source is drawn to under mode
+void     tft_fit(int sw, int sh, tft_fit_mode mode, int *x, int *y, int *w, int *h);
+
+// ── Line streaming ───────────────────────────────────────────────────────────
+// Fill window (x, y, w, h) top to bottom: each tft_stream_line() returns a
+// w-pixel buffer for the next line (RGB565 big-endian), valid until the next
+// call.  Full bands go out by DMA while later lines are built, and
+// tft_stream_end() queues the rest.  Exactly h lines must be requested;
+// w ≤ TFT_W.
+void      tft_stream_begin(int x, int y, int w, int h);
+uint16_t *tft_stream_line(void);
+void      tft_stream_end(void);
+
+// ── Hardware scrolling ───────────────────────────────────────────────────────
+// Screen rows [top, top+h) become a vertical scroll region (VSCRDEF); rows
+// outside it stay put.  tft_scroll(dy) moves the region's contents up by dy
+// rows (down if negative) without sending any pixels — the dy rows that wrap
+// round to the other edge are stale and are the caller's to redraw.  All
+// drawing calls keep taking screen coordinates.  Setting an area resets the
+// offset; h = 0 turns scrolling off.
+void     tft_scroll_area(int top, int h);
+void     tft_scroll(int dy);
+int      tft_scroll_offset(void);
+
+// ── Async transfers ──────────────────────────────────────────────────────────
+// A streamed window is done as soon as its last band is queued; DMA
+// finishes sending it in the background.  Every other drawing call waits
+// for the bus first, and so must anything else on spi0 (the SD card).
+
+// Send buf (w×h RGB565 big-endian) to the window at (x, y) by DMA and return
+// immediately.  buf must stay untouched until done(ctx) runs — from the DMA
+// IRQ — or tft_busy() reads false.  done may be NULL.
+typedef void (*tft_done_fn)(void *ctx);
+void     tft_blit_async(const uint8_t *buf, int x, int y, int w, int h,
+                        tft_done_fn done, void *ctx);
+bool     tft_busy(void);
+void     tft_wait(void);   // block until the display has released the bus
+
+// tft_wait(), then leave SCK/MOSI with the SPI peripheral for the SD card,
+// which sets its own baud; the display restores TFT_SPI_HZ when it next draws
+void     tft_release_bus(void);
+
+// The write clock actually in effect, after tft_init(): TFT_SPI_HZ or
+// TFT_PIO_HZ as the divider could get it from the system clock
+uint32_t tft_bus_hz(void);
+
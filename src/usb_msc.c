@@ -2,6 +2,8 @@
 #include "sd_card.h"
 #include "tusb.h"
 #include "pico/stdlib.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
 #include <stdio.h>
 #include <string.h>
 
@@ -66,6 +68,84 @@ const uint16_t *tud_descriptor_string_cb(uint8_t idx, uint16_t langid) {
     return _str_buf;
 }
 
+// ── Traffic statistics ────────────────────────────────────────────────────────
+// Single writer (the MSC callbacks and usb_msc_task, both in tud_task's
+// context); every field is one aligned word, so readers on either core or
+// in an interrupt see whole values without taking a lock.
+
+static volatile MscStats _stats[MSC_DIR_COUNT];
+static uint32_t          _rate_ms;
+static uint32_t          _rate_bytes[MSC_DIR_COUNT];
+static uint32_t          _rate_busy;
+static volatile uint32_t _load;
+
+static void _count(MscDir d, uint32_t bytes, bool ok, uint32_t t0) {
+    volatile MscStats *s = &_stats[d];
+    s->busy_us += time_us_32() - t0;
+    s->chunks++;
+    if (!ok) {
+        s->errors++;
+        return;
+    }
+    s->bytes  += bytes;
+    s->last_ms = to_ms_since_boot(get_absolute_time());
+}
+
+// One EWMA step of 1/2^MSC_RATE_SHIFT towards sample, rounded away from avg
+// so the estimate reaches the sample (and 0 once traffic stops) instead of
+// stalling up to 2^MSC_RATE_SHIFT - 1 short of it
+static int32_t _ewma_step(int32_t avg, int32_t sample) {
+    int32_t d = sample - avg;
+    int32_t r = (1 << MSC_RATE_SHIFT) - 1;
+    return avg + (d >= 0 ? (d + r) >> MSC_RATE_SHIFT : -((-d + r) >> MSC_RATE_SHIFT));
+}
+
+// Fold the bytes since the last tick into the EWMA.  A late call applies
+// one step per elapsed tick (up to 16) with the average over the gap.
+static void _rate_update(void) {
+    uint32_t now = to_ms_since_boot(get_absolute_time());
+    uint32_t dt  = now - _rate_ms;
+    if (dt < MSC_RATE_TICK_MS) return;
+    uint32_t ticks = dt / MSC_RATE_TICK_MS;
+    if (ticks > 16) ticks = 16;
+
+    uint32_t busy = _stats[MSC_DIR_READ].busy_us + _stats[MSC_DIR_WRITE].busy_us;
+    int32_t  pct  = (int32_t)((uint64_t)(busy - _rate_busy) * 100 / ((uint64_t)dt * 1000));
+    int32_t  load = (int32_t)_load;
+    if (pct > 100) pct = 100;
+    for (uint32_t k = 0; k < ticks; k++)
+        load = _ewma_step(load, pct);
+    _load      = (uint32_t)load;
+    _rate_busy = busy;
+
+    for (int d = 0; d < MSC_DIR_COUNT; d++) {
+        uint32_t bytes  = _stats[d].bytes;
+        int32_t  sample = (int32_t)((uint64_t)(bytes - _rate_bytes[d]) * 1000 / dt);
+        int32_t  rate   = (int32_t)_stats[d].rate;
+        for (uint32_t k = 0; k < ticks; k++)
+            rate = _ewma_step(rate, sample);
+        _stats[d].rate = (uint32_t)rate;
+        if ((uint32_t)rate > _stats[d].peak) _stats[d].peak = (uint32_t)rate;
+        _rate_bytes[d] = bytes;
+    }
+    _rate_ms = now;
+}
+
+// ── Wakeups ───────────────────────────────────────────────────────────────────
+// Runs after TinyUSB's own handler on USBCTRL_IRQ
+
+static volatile bool     _irq_pending;
+static volatile uint32_t _irq_at;
+static volatile MscLatency _latency;
+
+static void _usb_irq(void) {
+    if (!_irq_pending) {
+        _irq_at      = time_us_32();
+        _irq_pending = true;
+    }
+    __sev();
+}
+
 // ── MSC callbacks ─────────────────────────────────────────────────────────────
 
 void tud_msc_inquiry_cb(uint8_t lun, uint8_t vendor_id[8],
@@ -98,18 +178,20 @@ int32_t tud_msc_read10_cb(uint8_t lun, uint32_t lba,
                            uint32_t offset, void *buf, uint32_t bufsize) {
     (void)lun; (void)offset;
     uint32_t count = bufsize / 512;
-    return sd_read_blocks(lba, buf, count) ? (int32_t)bufsize : -1;
+    uint32_t t0 = time_us_32();
+    bool ok = sd_read_blocks(lba, buf, count);
+    _count(MSC_DIR_READ, bufsize, ok, t0);
+    return ok ? (int32_t)bufsize : -1;
 }
 
-// Implemented in main.c — called on every MSC write
-extern void notify_msc_write(void);
-
 int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba,
                             uint32_t offset, uint8_t *buf, uint32_t bufsize) {
     (void)lun; (void)offset;
     uint32_t count = bufsize / 512;
-    notify_msc_write();
-    return sd_write_blocks(lba, buf, count) ? (int32_t)bufsize : -1;
+    uint32_t t0 = time_us_32();
+    bool ok = sd_write_blocks(lba, buf, count);
+    _count(MSC_DIR_WRITE, bufsize, ok, t0);
+    return ok ? (int32_t)bufsize : -1;
 }
 
 int32_t tud_msc_scsi_cb(uint8_t lun, uint8_t const scsi_cmd[16],
@@ -122,14 +204,61 @@ int32_t tud_msc_scsi_cb(uint8_t lun, uint8_t const scsi_cmd[16],
 
 void usb_msc_init(void) {
     tusb_init();
+    irq_add_shared_handler(USBCTRL_IRQ, _usb_irq,
+                           PICO_SHARED_IRQ_HANDLER_LOWEST_ORDER_PRIORITY);
     // Pump USB for 800ms so Windows receives enumeration packets
     // before we start doing slow SPI work in the main loop.
     uint32_t start = to_ms_since_boot(get_absolute_time());
     while (to_ms_since_boot(get_absolute_time()) - start < 800) {
         tud_task();
     }
+    _rate_ms = to_ms_since_boot(get_absolute_time());
 }
 
 void usb_msc_task(void) {
+    if (_irq_pending) {
+        uint32_t us = time_us_32() - _irq_at;
+        _irq_pending = false;
+        _latency.count++;
+        _latency.sum_us += us;
+        if (us > _latency.max_us) _latency.max_us = us;
+    }
     tud_task();
-}
\ No newline at end of file
+    _rate_update();
+}
+
+void usb_msc_stats(MscDir d, MscStats *out) {
+    const volatile MscStats *s = &_stats[d];
+    out->bytes   = s->bytes;
+    out->chunks  = s->chunks;
+    out->errors  = s->errors;
+    out->last_ms = s->last_ms;
+    out->busy_us = s->busy_us;
+    out->rate    = s->rate;
+    out->peak    = s->peak;
+}
+
+uint32_t usb_msc_rate(MscDir d) {
+    return _stats[d].rate;
+}
+
+bool usb_msc_pending(void) {
+    return _irq_pending;
+}
+
+void usb_msc_latency(MscLatency *out) {
+    out->count  = _latency.count;
+    out->sum_us = _latency.sum_us;
+    out->max_us = _latency.max_us;
+    _latency.max_us = 0;
+}
+
+uint32_t usb_msc_load(void) {
+    return _load;
+}
+
+bool usb_msc_active(MscDir d, uint32_t idle_ms) {
+    if (_stats[d].chunks == 0) return false;
+    uint32_t now = to_ms_since_boot(get_absolute_time());
+    return now - _stats[d].last_ms < idle_ms;
+}
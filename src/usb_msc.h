@@ -1,4 +1,6 @@
 #pragma once
+#include <stdint.h>
+#include <stdbool.h>
 
 // Initialise TinyUSB and register SD card as MSC drive.
 // Call once from core 0 before starting the animation loop.
@@ -7,3 +9,53 @@ void usb_msc_init(void);
 // Poll TinyUSB — must be called regularly from the main loop.
 // Handles USB enumeration and MSC read/write requests from the PC.
 void usb_msc_task(void);
+
+// The USB interrupt issues an event (SEV) whenever it queues work for
+// usb_msc_task(), so the main loop can sleep in __wfe() between polls.
+// Latency is measured from the first interrupt after a poll to the next
+// usb_msc_task() call.
+typedef struct {
+    uint32_t count;     // interrupts timed
+    uint32_t sum_us;    // their total latency (wraps)
+    uint32_t max_us;    // worst since the last usb_msc_latency() call
+} MscLatency;
+
+void usb_msc_latency(MscLatency *out);
+
+// An interrupt has queued work since the last usb_msc_task()
+bool usb_msc_pending(void);
+
+// ── Traffic statistics ───────────────────────────────────────────────────────
+// Per-direction counters kept by the READ10/WRITE10 callbacks, and an EWMA
+// of throughput updated by usb_msc_task() every MSC_RATE_TICK_MS.  Cheap
+// enough to leave on in every build.
+
+#define MSC_RATE_TICK_MS  100
+#define MSC_RATE_SHIFT    2     // each tick moves the estimate 1/4 of the way
+
+typedef enum { MSC_DIR_READ = 0, MSC_DIR_WRITE, MSC_DIR_COUNT } MscDir;
+
+typedef struct {
+    uint32_t bytes;     // transferred since boot (wraps; take differences)
+    uint32_t chunks;    // callbacks served: a READ10/WRITE10 arrives in
+                        // CFG_TUD_MSC_EP_BUFSIZE pieces, so not commands
+    uint32_t errors;    // chunks the card failed
+    uint32_t last_ms;   // when the last chunk completed
+    uint32_t busy_us;   // time spent in the card serving them (wraps)
+    uint32_t rate;      // EWMA throughput, bytes/s
+    uint32_t peak;      // highest rate seen since boot
+} MscStats;
+
+// Snapshot of one direction.  Lock-free: each field is read whole, but
+// fields may come from adjacent updates.
+void     usb_msc_stats(MscDir d, MscStats *out);
+
+// Current throughput estimate in bytes/s
+uint32_t usb_msc_rate(MscDir d);
+
+// A chunk in direction d completed within the last idle_ms
+bool     usb_msc_active(MscDir d, uint32_t idle_ms);
+
+// EWMA of the share of time spent serving commands, both directions, in
+// percent: how close the card is to saturation.
+uint32_t usb_msc_load(void);
@@ -0,0 +1,663 @@
+// spritepack — host tool that packs sprites/ into a flash atlas.
+//
+//   spritepack <sprites dir> <output dir>
+//
+// Writes to <output dir>:
+//   sprite_atlas.bin  every palette and frame payload, deduplicated
+//   sprite_atlas.S    .incbin wrapper exporting it as sprite_atlas[]
+//   sprites.h         sprite_table[] indexing into the atlas
+//
+// Expected filename format:  <character>/<SIZE>_<STATE>_<N>.bmp
+//   SIZE:  SMALL | MEDIUM | LARGE
+//   STATE: IDLE | TRANSFER | CONNECT | ENDTRANSFER
+//   N:     frame number (1, 2, 3 ...)
+//
+// Every character is quantised to one shared RGB565 palette. Index 0 is
+// reserved for transparent pixels and is black: alpha 0 in 32-bit BMPs, or
+// in a BMP without alpha the colour all four corners share, if they do.
+// Characters with up to 15 opaque colours are stored at 4 bpp, otherwise
+// 8 bpp; more than 255 colours are reduced by dropping low channel bits.
+//
+// Within an animation the first frame is stored in full (LZ-compressed when
+// that is smaller) and every later frame as the spans of pixels that changed
+// since the frame before it, plus a wrap delta from the last frame back to
+// the first.  See src/sprite.h for the payload formats.
+//
+// Each animation is trimmed to the union of its frames' content boxes: the
+// border rows and columns that are transparent in every frame are dropped,
+// and the entry records where the kept box sits in the full frame.
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// ── Names (must match the Tier / AnimState enums in main.c) ───────────────────
+
+const char *const kTiers[]  = { "SMALL", "MEDIUM", "LARGE" };
+const char *const kStates[] = { "IDLE", "TRANSFER", "CONNECT", "ENDTRANSFER" };
+
+int lookup(const char *const *names, int n, const std::string &s) {
+    for (int i = 0; i < n; i++)
+        if (s == names[i]) return i;
+    return -1;
+}
+
+std::string upper(std::string s) {
+    for (char &c : s) c = (char)toupper((unsigned char)c);
+    return s;
+}
+
+std::string lower(std::string s) {
+    for (char &c : s) c = (char)tolower((unsigned char)c);
+    return s;
+}
+
+// ── BMP ───────────────────────────────────────────────────────────────────────
+
+struct Image {
+    int w = 0, h = 0;
+    std::vector<int> px;    // RGB565, or -1 for transparent
+};
+
+uint32_t u16(const std::vector<uint8_t> &b, size_t o) { return b[o] | b[o+1] << 8; }
+uint32_t u32(const std::vector<uint8_t> &b, size_t o) { return u16(b, o) | u16(b, o+2) << 16; }
+
+bool load_bmp(const fs::path &path, Image &img) {
+    std::ifstream f(path, std::ios::binary);
+    std::vector<uint8_t> b((std::istreambuf_iterator<char>(f)), {});
+    if (b.size() < 54 || b[0] != 'B' || b[1] != 'M') {
+        fprintf(stderr, "  Warning: %s is not a BMP — skipping\n", path.c_str());
+        return false;
+    }
+    uint32_t off  = u32(b, 10);
+    int32_t  w    = (int32_t)u32(b, 18);
+    int32_t  h    = (int32_t)u32(b, 22);
+    uint32_t bpp  = u16(b, 28);
+    uint32_t comp = u32(b, 30);
+    if (!((bpp == 24 && comp == 0) || (bpp == 32 && (comp == 0 || comp == 3)))) {
+        fprintf(stderr, "  Warning: %s unsupported bpp=%u comp=%u — skipping\n",
+                path.c_str(), bpp, comp);
+        return false;
+    }
+    bool flip = h > 0;
+    if (h < 0) h = -h;
+    int bypp = bpp / 8;
+    size_t stride = ((size_t)w * bypp + 3) & ~(size_t)3;
+    if (w <= 0 || off + stride * h > b.size()) {
+        fprintf(stderr, "  Warning: %s truncated — skipping\n", path.c_str());
+        return false;
+    }
+
+    // A 32-bit BMP whose alpha bytes are all zero carries no alpha
+    bool has_alpha = false;
+    if (bpp == 32)
+        for (int y = 0; y < h && !has_alpha; y++)
+            for (int x = 0; x < w && !has_alpha; x++)
+                has_alpha = b[off + y * stride + x * 4 + 3] != 0;
+
+    img.w = w;
+    img.h = h;
+    img.px.resize((size_t)w * h);
+    for (int y = 0; y < h; y++) {
+        const uint8_t *src = &b[off + (flip ? h - 1 - y : y) * stride];
+        for (int x = 0; x < w; x++) {
+            const uint8_t *p = src + x * bypp;
+            img.px[y * w + x] = (has_alpha && p[3] == 0)
+                ? -1 : ((p[2] & 0xF8) << 8) | ((p[1] & 0xFC) << 3) | (p[0] >> 3);
+        }
+    }
+
+    // Without alpha, a colour shared by all four corners is the background:
+    // transparent wherever it appears, so trimming and drawing agree
+    if (!has_alpha) {
+        int key = img.px[0];
+        if (img.px[w - 1] == key && img.px[(h - 1) * w] == key && img.px[h * w - 1] == key)
+            std::replace(img.px.begin(), img.px.end(), key, -1);
+    }
+    return true;
+}
+
+// ── Palette ───────────────────────────────────────────────────────────────────
+
+// Keep the top (5-drop, 6-drop, 5-drop) bits of an RGB565 colour and centre
+// the dropped bits so the bucket colour sits mid-range
+int quant(int c, int drop) {
+    if (drop == 0) return c;
+    int m = 1 << drop;
+    int r = (c >> 11) / m * m + m / 2;
+    int g = ((c >> 5) & 0x3F) / m * m + m / 2;
+    int b = (c & 0x1F) / m * m + m / 2;
+    return r << 11 | g << 5 | b;
+}
+
+struct Palette {
+    int bpp = 4;
+    int drop = 0;
+    std::vector<uint16_t> colours;      // index 0 = transparent
+    std::map<int, int>    index;        // quantised colour → index
+};
+
+Palette build_palette(const std::set<int> &seen) {
+    Palette pal;
+    std::set<int> buckets;
+    for (pal.drop = 0; pal.drop < 5; pal.drop++) {
+        buckets.clear();
+        for (int c : seen) buckets.insert(quant(c, pal.drop));
+        if (buckets.size() <= 255) break;
+    }
+    pal.bpp = buckets.size() <= 15 ? 4 : 8;
+    pal.colours.assign(1u << pal.bpp, 0);
+    int i = 1;
+    for (int c : buckets) {
+        pal.index[c] = i;
+        pal.colours[i++] = (uint16_t)c;
+    }
+    return pal;
+}
+
+// ── Trimming ──────────────────────────────────────────────────────────────────
+
+struct Box {
+    int x = 0, y = 0, w = 0, h = 0;
+};
+
+// Bounding box of the pixels that are not transparent.  w = 0 if the frame
+// is all transparent.
+Box content_box(const Image &img) {
+    int w = img.w, h = img.h;
+    int x0 = w, y0 = h, x1 = -1, y1 = -1;
+    for (int y = 0; y < h; y++)
+        for (int x = 0; x < w; x++)
+            if (img.px[y * w + x] >= 0) {
+                x0 = std::min(x0, x); x1 = std::max(x1, x);
+                y0 = std::min(y0, y); y1 = std::max(y1, y);
+            }
+    if (x1 < 0) return {};
+    return { x0, y0, x1 - x0 + 1, y1 - y0 + 1 };
+}
+
+Box box_union(const Box &a, const Box &b) {
+    if (a.w == 0) return b;
+    if (b.w == 0) return a;
+    int x0 = std::min(a.x, b.x), y0 = std::min(a.y, b.y);
+    int x1 = std::max(a.x + a.w, b.x + b.w), y1 = std::max(a.y + a.h, b.y + b.h);
+    return { x0, y0, x1 - x0, y1 - y0 };
+}
+
+std::vector<int> crop(const std::vector<int> &ix, int w, const Box &b) {
+    std::vector<int> out;
+    out.reserve((size_t)b.w * b.h);
+    for (int y = b.y; y < b.y + b.h; y++)
+        out.insert(out.end(), ix.begin() + y * w + b.x, ix.begin() + y * w + b.x + b.w);
+    return out;
+}
+
+// ── Payload encoders ──────────────────────────────────────────────────────────
+
+using Bytes = std::vector<uint8_t>;
+
+void put_index(Bytes &out, size_t base, int x, int v, int bpp) {
+    if (bpp == 8)        out[base + x] = (uint8_t)v;
+    else if (x % 2 == 0) out[base + x / 2] = (uint8_t)(v << 4);
+    else                 out[base + x / 2] |= (uint8_t)v;
+}
+
+Bytes encode_key(const std::vector<int> &ix, int w, int h, int bpp) {
+    size_t rs = (w * bpp + 7) / 8;
+    Bytes out(rs * h, 0);
+    for (int y = 0; y < h; y++)
+        for (int x = 0; x < w; x++)
+            put_index(out, y * rs, x, ix[y * w + x], bpp);
+    return out;
+}
+
+// <skip> <count> <count packed indices>; a span never crosses a row
+Bytes encode_delta(const std::vector<int> &a, const std::vector<int> &b,
+                   int w, int h, int bpp) {
+    Bytes out;
+    int pos = 0;
+    for (int y = 0; y < h; y++) {
+        int x = 0;
+        while (x < w) {
+            if (a[y * w + x] == b[y * w + x]) { x++; continue; }
+            int s = x;
+            while (x < w && x - s < 255 && a[y * w + x] != b[y * w + x]) x++;
+            int cnt  = x - s;
+            int skip = y * w + s - pos;
+            for (; skip > 255; skip -= 255) { out.push_back(255); out.push_back(0); }
+            out.push_back((uint8_t)skip);
+            out.push_back((uint8_t)cnt);
+            size_t base = out.size();
+            out.resize(base + (cnt * bpp + 7) / 8, 0);
+            for (int k = 0; k < cnt; k++) put_index(out, base, k, b[y * w + s + k], bpp);
+            pos = y * w + x;
+        }
+    }
+    return out;
+}
+
+void lz_length(Bytes &out, int n) {
+    for (n -= 15; n >= 255; n -= 255) out.push_back(255);
+    out.push_back((uint8_t)n);
+}
+
+void lz_sequence(Bytes &out, const Bytes &in, size_t start, int nlit, int mlen, int off) {
+    out.push_back((uint8_t)(std::min(nlit, 15) << 4 | (mlen ? std::min(mlen - 3, 15) : 0)));
+    if (nlit >= 15) lz_length(out, nlit);
+    out.insert(out.end(), in.begin() + start, in.begin() + start + nlit);
+    if (mlen) {
+        out.push_back((uint8_t)off);
+        if (mlen - 3 >= 15) lz_length(out, mlen - 3);
+    }
+}
+
+// Greedy longest match within the last 255 bytes, minimum match 3
+Bytes lz_compress(const Bytes &in) {
+    Bytes out;
+    size_t i = 0, ls = 0, n = in.size();
+    while (i < n) {
+        int best = 0, bo = 0;
+        for (size_t d = 1; d <= 255 && d <= i; d++) {
+            size_t l = 0;
+            while (i + l < n && in[i + l - d] == in[i + l]) l++;
+            if ((int)l > best) { best = (int)l; bo = (int)d; }
+        }
+        if (best >= 3) {
+            lz_sequence(out, in, ls, (int)(i - ls), best, bo);
+            i += best;
+            ls = i;
+        } else {
+            i++;
+        }
+    }
+    lz_sequence(out, in, ls, (int)(n - ls), 0, 0);
+    return out;
+}
+
+// ── Atlas with content-hash deduplication ─────────────────────────────────────
+
+uint64_t fnv1a(const Bytes &b) {
+    uint64_t h = 0xcbf29ce484222325ull;
+    for (uint8_t c : b) { h ^= c; h *= 0x100000001b3ull; }
+    return h;
+}
+
+struct Atlas {
+    Bytes data;
+    std::unordered_multimap<uint64_t, size_t> by_hash;
+    size_t requested = 0, deduped = 0;
+
+    size_t add(const Bytes &b, size_t align = 1) {
+        requested += b.size();
+        uint64_t h = fnv1a(b);
+        auto range = by_hash.equal_range(h);
+        for (auto it = range.first; it != range.second; ++it)
+            if (it->second % align == 0 && it->second + b.size() <= data.size() &&
+                std::equal(b.begin(), b.end(), data.begin() + it->second)) {
+                deduped += b.size();
+                return it->second;
+            }
+        while (data.size() % align) data.push_back(0);
+        size_t off = data.size();
+        data.insert(data.end(), b.begin(), b.end());
+        by_hash.emplace(h, off);
+        return off;
+    }
+};
+
+// ── Sprites ───────────────────────────────────────────────────────────────────
+
+struct Frame {
+    fs::path    path;
+    std::string character;
+    int         tier, state, n;
+    Image       img;
+};
+
+// Consecutive frames of one animation (same state, tier and size)
+bool same_run(const Frame &a, const Frame &b) {
+    return a.character == b.character && a.tier == b.tier && a.state == b.state &&
+           a.img.w == b.img.w && a.img.h == b.img.h;
+}
+
+struct Entry {
+    std::string comment;
+    size_t      off, len, pal_off;
+    int         w, h, bpp;
+    int         x, y, fw, fh;       // stored box within the full fw×fh frame
+    const char *kind;
+    int         tier, state;
+    int         character;
+};
+
+// First entry and entry count of one (character, state, tier) sequence
+struct Seq {
+    size_t first = 0, count = 0;
+};
+
+// C identifier for a character ID: SPRITE_CHAR_<NAME>
+std::string char_symbol(const std::string &name) {
+    std::string s = "SPRITE_CHAR_";
+    for (char c : upper(name)) s += isalnum((unsigned char)c) ? c : '_';
+    return s;
+}
+
+// Apply main.c's fallback order; sets the state/tier actually used
+const Seq *resolve(const std::array<std::array<Seq, 3>, 4> &seq, int state, int tier,
+                   int &out_state, int &out_tier) {
+    int states[2] = { state, 0 };
+    int n_states  = state == 0 ? 1 : 2;
+    int tiers[3], n_tiers = 0;
+    tiers[n_tiers++] = tier;
+    for (int d = 1; d < 3; d++) {
+        if (tier - d >= 0) tiers[n_tiers++] = tier - d;
+        if (tier + d < 3)  tiers[n_tiers++] = tier + d;
+    }
+    for (int si = 0; si < n_states; si++)
+        for (int ti = 0; ti < n_tiers; ti++)
+            if (seq[states[si]][tiers[ti]].count) {
+                out_state = states[si];
+                out_tier  = tiers[ti];
+                return &seq[states[si]][tiers[ti]];
+            }
+    return nullptr;
+}
+
+bool write_file(const fs::path &path, const std::string &text) {
+    std::ofstream f(path, std::ios::binary);
+    f << text;
+    if (!f) {
+        fprintf(stderr, "Error: cannot write %s\n", path.c_str());
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s <sprites dir> <output dir>\n", argv[0]);
+        return 2;
+    }
+    fs::path in_dir = argv[1], out_dir = argv[2];
+    if (!fs::is_directory(in_dir)) {
+        fprintf(stderr, "Error: '%s' directory not found.\n", in_dir.c_str());
+        return 1;
+    }
+
+    // ── Collect and parse frames ─────────────────────────────────────────────
+    std::vector<Frame> frames;
+    size_t bmp_bytes = 0;
+    for (const auto &de : fs::recursive_directory_iterator(in_dir)) {
+        if (!de.is_regular_file() || upper(de.path().extension().string()) != ".BMP")
+            continue;
+        fs::path rel = fs::relative(de.path(), in_dir);
+        std::string base = upper(de.path().stem().string());
+        std::string parts[3];
+        std::istringstream ss(base);
+        for (auto &p : parts) std::getline(ss, p, '_');
+
+        Frame f;
+        f.path      = de.path();
+        f.character = lower(rel.begin()->string());
+        f.tier      = lookup(kTiers, 3, parts[0]);
+        f.state     = lookup(kStates, 4, parts[1]);
+        f.n         = parts[2].empty() ? 1 : atoi(parts[2].c_str());
+        if (f.tier < 0) {
+            fprintf(stderr, "  Warning: unknown size '%s' in %s — skipping\n",
+                    parts[0].c_str(), f.path.c_str());
+            continue;
+        }
+        if (f.state < 0) {
+            fprintf(stderr, "  Warning: unknown state '%s' in %s — skipping\n",
+                    parts[1].c_str(), f.path.c_str());
+            continue;
+        }
+        if (!load_bmp(f.path, f.img)) continue;
+        bmp_bytes += fs::file_size(f.path);
+        frames.push_back(std::move(f));
+    }
+    if (frames.empty()) {
+        fprintf(stderr, "Error: No .BMP files found under %s/\n", in_dir.c_str());
+        return 1;
+    }
+
+    // Grouped and sorted by (character, state, tier), each sequence in frame
+    // order, so every sequence is one contiguous run of sprite_table
+    std::sort(frames.begin(), frames.end(), [](const Frame &a, const Frame &b) {
+        if (a.character != b.character) return a.character < b.character;
+        if (a.state != b.state) return a.state < b.state;
+        if (a.tier  != b.tier)  return a.tier  < b.tier;
+        return a.n < b.n;
+    });
+
+    // ── Encode ───────────────────────────────────────────────────────────────
+    Atlas atlas;
+    std::vector<Entry> entries;
+    std::vector<std::string> characters;
+    std::vector<std::array<std::array<Seq, 3>, 4>> seqs;   // [char][state][tier]
+    std::string palettes_comment;
+    size_t full_px = 0, trimmed_px = 0;
+
+    for (size_t c0 = 0; c0 < frames.size();) {
+        size_t c1 = c0;
+        std::set<int> seen;
+        for (; c1 < frames.size() && frames[c1].character == frames[c0].character; c1++)
+            for (int v : frames[c1].img.px)
+                if (v >= 0) seen.insert(v);
+        const std::string &character = frames[c0].character;
+        int char_id = (int)characters.size();
+        characters.push_back(character);
+        seqs.emplace_back();
+
+        Palette pal = build_palette(seen);
+        Bytes pal_bytes;
+        for (uint16_t c : pal.colours) {      // big-endian, ready to send
+            pal_bytes.push_back((uint8_t)(c >> 8));
+            pal_bytes.push_back((uint8_t)c);
+        }
+        size_t pal_off = atlas.add(pal_bytes, 2);
+        palettes_comment += "//   " + character + ": " +
+            std::to_string(pal.index.size()) + " colour(s), " +
+            std::to_string(pal.bpp) + " bpp\n";
+
+        std::vector<std::vector<int>> ix(c1 - c0);
+        for (size_t i = c0; i < c1; i++)
+            for (int v : frames[i].img.px)
+                ix[i - c0].push_back(v < 0 ? 0 : pal.index[quant(v, pal.drop)]);
+
+        // Trim every animation to the union of its frames' content boxes, so
+        // deltas still line up frame to frame
+        std::vector<Box> box(c1 - c0);
+        for (size_t r0 = c0; r0 < c1;) {
+            size_t r1 = r0 + 1;
+            while (r1 < c1 && same_run(frames[r1 - 1], frames[r1])) r1++;
+            const Image &img = frames[r0].img;
+            Box b;
+            for (size_t i = r0; i < r1; i++) b = box_union(b, content_box(frames[i].img));
+            if (b.w == 0) b = { 0, 0, img.w, img.h };   // blank: keep as is
+            for (size_t i = r0; i < r1; i++) {
+                box[i - c0] = b;
+                ix[i - c0]  = crop(ix[i - c0], img.w, b);
+            }
+            full_px    += (r1 - r0) * (size_t)img.w * img.h;
+            trimmed_px += (r1 - r0) * (size_t)b.w * b.h;
+            if (b.w != img.w || b.h != img.h)
+                printf("  %s %s_%s: trimmed %dx%d to %dx%d at (%d,%d)\n", character.c_str(),
+                       kTiers[frames[r0].tier], kStates[frames[r0].state],
+                       img.w, img.h, b.w, b.h, b.x, b.y);
+            r0 = r1;
+        }
+
+        auto emit = [&](size_t i, const Bytes &payload, const char *kind, const std::string &what) {
+            const Frame &f = frames[i];
+            const Box   &b = box[i - c0];
+            Entry e;
+            e.comment   = (in_dir.filename() / fs::relative(f.path, in_dir)).generic_string() + " (" + what + ")";
+            e.off       = atlas.add(payload);
+            e.len       = payload.size();
+            e.pal_off   = pal_off;
+            e.w = b.w; e.h = b.h; e.bpp = pal.bpp;
+            e.x = b.x; e.y = b.y; e.fw = f.img.w; e.fh = f.img.h;
+            e.kind      = kind;
+            e.tier      = f.tier;
+            e.state     = f.state;
+            e.character = char_id;
+            Seq &q = seqs[char_id][f.state][f.tier];
+            if (q.count++ == 0) q.first = entries.size();
+            printf("  %s -> %zu bytes, %s %s, %s\n", e.comment.c_str(), e.len,
+                   kTiers[f.tier], kStates[f.state], kind);
+            entries.push_back(e);
+        };
+
+        size_t first = c0;
+        for (size_t i = c0; i < c1; i++) {
+            const Frame &f = frames[i];
+            const Box &b = box[i - c0];
+            bool same = i > c0 && same_run(frames[i-1], f);
+            if (!same) first = i;
+
+            if (same) {
+                emit(i, encode_delta(ix[i-1-c0], ix[i-c0], b.w, b.h, pal.bpp),
+                     "SPRITE_DELTA", "delta from previous frame");
+            } else {
+                Bytes raw = encode_key(ix[i-c0], b.w, b.h, pal.bpp);
+                Bytes lz  = lz_compress(raw);
+                if (lz.size() < raw.size())
+                    emit(i, lz, "SPRITE_KEY_LZ", "LZ key frame, " + std::to_string(raw.size()) + " bytes raw");
+                else
+                    emit(i, raw, "SPRITE_KEY", "key frame");
+            }
+
+            // Last frame of a multi-frame sequence: delta back to the first
+            bool last = i + 1 == c1 || !same_run(f, frames[i+1]);
+            if (last && i != first)
+                emit(i, encode_delta(ix[i-c0], ix[first-c0], b.w, b.h, pal.bpp),
+                     "SPRITE_WRAP", "loop delta back to first frame");
+        }
+        c0 = c1;
+    }
+    while (atlas.data.size() % 4) atlas.data.push_back(0);
+
+    // ── Write outputs ────────────────────────────────────────────────────────
+    fs::create_directories(out_dir);
+    fs::path bin_path = fs::absolute(out_dir / "sprite_atlas.bin");
+    {
+        std::ofstream f(bin_path, std::ios::binary);
+        f.write((const char *)atlas.data.data(), (std::streamsize)atlas.data.size());
+        if (!f) {
+            fprintf(stderr, "Error: cannot write %s\n", bin_path.c_str());
+            return 1;
+        }
+    }
+
+    std::string s;
+    s += "// Auto-generated by spritepack — do not edit manually.\n";
+    s += "    .section .rodata.sprite_atlas, \"a\"\n";
+    s += "    .global sprite_atlas\n";
+    s += "    .balign 4\n";
+    s += "sprite_atlas:\n";
+    s += "    .incbin \"" + bin_path.generic_string() + "\"\n";
+    s += "    .size sprite_atlas, . - sprite_atlas\n";
+    if (!write_file(out_dir / "sprite_atlas.S", s)) return 1;
+
+    std::ostringstream h;
+    h << "#pragma once\n"
+         "#include <stdint.h>\n"
+         "#include \"sprite.h\"\n"
+         "\n"
+         "// Auto-generated by spritepack from sprites/ — do not edit manually.\n"
+         "// Rebuilt by the firmware build whenever a sprite changes.\n"
+         "//\n"
+         "// Palettes and frame payloads live in sprite_atlas[] (sprite_atlas.bin),\n"
+         "// identical payloads stored once.  Palettes hold RGB565 big-endian\n"
+         "// colours (ready to send); index 0 is transparent.\n"
+         "//\n"
+      << palettes_comment
+      << "\n"
+         "extern const uint8_t sprite_atlas[];\n"
+         "#define SPRITE_ATLAS_SIZE " << atlas.data.size() << "\n"
+         "\n"
+         "// ── Characters ────────────────────────────────────────────────────────────────\n"
+         "\n"
+         "typedef enum {\n";
+    for (const std::string &c : characters)
+        h << "    " << char_symbol(c) << ",\n";
+    h << "    SPRITE_CHAR_COUNT\n"
+         "} SpriteCharacter;\n"
+         "\n"
+         "static const char *const sprite_char_name[SPRITE_CHAR_COUNT] = {\n";
+    for (const std::string &c : characters)
+        h << "    \"" << c << "\",\n";
+    h << "};\n"
+         "\n"
+         "// ── Sprite table ──────────────────────────────────────────────────────────────\n"
+         "// Sorted by (character, state, tier); each sequence is a contiguous run.\n"
+         "// Tier and AnimState values match the enums in main.c; SpriteEntry and the\n"
+         "// SpriteKind values are declared in sprite.h.\n"
+         "\n"
+         "#define SPRITE_PAL(off) ((const uint16_t *)(sprite_atlas + (off)))\n"
+         "\n"
+         "static const SpriteEntry sprite_table[] = {\n";
+    for (const Entry &e : entries) {
+        char line[256];
+        snprintf(line, sizeof line,
+                 "    { sprite_atlas + 0x%04zx, %3zu, %d, %d, %d, %d, %d, %d, %d, SPRITE_PAL(0x%04zx), %-13s, TIER_%s, STATE_%s, %s },\n",
+                 e.off, e.len, e.w, e.h, e.x, e.y, e.fw, e.fh, e.bpp, e.pal_off, e.kind,
+                 kTiers[e.tier], kStates[e.state], char_symbol(characters[e.character]).c_str());
+        h << "    // " << e.comment << "\n" << line;
+    }
+    h << "};\n"
+         "\n"
+         "static const int sprite_table_len = " << entries.size() << ";\n"
+         "\n"
+         "// ── Sequence index ────────────────────────────────────────────────────────────\n"
+         "// sprite_index[character][state][tier] is the sequence to play, with the\n"
+         "// fallback already applied: requested state, then IDLE; within each, the\n"
+         "// requested tier, then nearest smaller, then nearest larger.  count 0 means\n"
+         "// there is nothing to fall back to.\n"
+         "\n"
+         "_Static_assert(STATE_COUNT == 4 && TIER_COUNT == 3,\n"
+         "               \"sprite_index dimensions out of date — rebuild spritepack\");\n"
+         "\n"
+         "static const SpriteSeq sprite_index[SPRITE_CHAR_COUNT][STATE_COUNT][TIER_COUNT] = {\n";
+    for (size_t c = 0; c < characters.size(); c++) {
+        h << "    { // " << characters[c] << "\n";
+        for (int st = 0; st < 4; st++) {
+            h << "        {";
+            for (int t = 0; t < 3; t++) {
+                int rs = st, rt = t;
+                const Seq *q = resolve(seqs[c], st, t, rs, rt);
+                char cell[96];
+                snprintf(cell, sizeof cell, " { %3zu, %2zu, TIER_%s, STATE_%s }%s",
+                         q ? q->first : 0, q ? q->count : 0,
+                         kTiers[rt], kStates[rs], t < 2 ? "," : " ");
+                h << cell;
+            }
+            h << "},  // " << kStates[st] << "\n";
+        }
+        h << "    },\n";
+    }
+    h << "};\n";
+    if (!write_file(out_dir / "sprites.h", h.str())) return 1;
+
+    printf("Done — %zu sprite(s) from %zu BMP(s): atlas %zu bytes "
+           "(%zu deduplicated) vs %zu bytes of BMP; trimming kept %zu of %zu pixels (%zu%%)\n",
+           entries.size(), frames.size(), atlas.data.size(), atlas.deduped, bmp_bytes,
+           trimmed_px, full_px, full_px ? trimmed_px * 100 / full_px : 0);
+    return 0;
+}